@@ -0,0 +1,123 @@
+///
+/// @file Example_Flush_Async.ino
+/// @brief Example of non-blocking update
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 02 May 2023
+/// @version 609
+///
+/// @copyright (c) Rei Vilo, 2010-2023
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// @see ReadMe.txt for references
+/// @n
+///
+
+// SDK
+#if defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#else // Arduino general
+#include "Arduino.h"
+#endif // SDK
+
+// Set parameters
+
+// Include application, user and local libraries
+#include "SPI.h"
+#include "PDLS_EXT3_Basic.h"
+
+// Define structures and classes
+
+// Define variables and constants
+Screen_EPD_EXT3 myScreen(eScreen_EPD_EXT3_370, boardRaspberryPiPico_RP2040);
+
+uint8_t myUpdates = 0;
+uint32_t myChrono = 0;
+uint32_t myLoops = 0;
+volatile bool flagDone = false;
+
+// Prototypes
+
+// Functions
+///
+/// @brief Called by poll() on completion
+///
+void done()
+{
+    flagDone = true;
+}
+
+///
+/// @brief Draw next frame and start update
+///
+void update()
+{
+    myScreen.clear();
+    myScreen.selectFont(Font_Terminal12x16);
+    myScreen.gText(10, 10, formatString("Update %i", myUpdates));
+    myScreen.gText(10, 40, formatString("Loops during last %i", myLoops));
+
+    myChrono = millis();
+    myLoops = 0;
+
+    if (myScreen.flushAsync() == RESULT_SUCCESS)
+    {
+        Serial.println(formatString("Update %i started, ETA %i ms", myUpdates, myScreen.getFlushETA()));
+    }
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    Serial.begin(115200);
+    delay(500);
+    Serial.println();
+    Serial.println("=== " __FILE__);
+    Serial.println("=== " __DATE__ " " __TIME__);
+    Serial.println();
+
+    Serial.print("begin... ");
+    myScreen.begin();
+    Serial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    myScreen.onComplete(done);
+    update();
+}
+
+// Add loop code
+///
+/// @brief Loop, update running while the sketch goes on
+///
+void loop()
+{
+    // Run the update until next wait
+    myScreen.poll();
+    myLoops++;
+
+    // Other tasks here, frame-buffer untouched while isBusy()
+
+    if (flagDone)
+    {
+        flagDone = false;
+        Serial.println(formatString("Update %i %s in %i ms, %i loops", myUpdates,
+                                    (myScreen.getUpdateResult() == RESULT_SUCCESS) ? "done" : "timed out",
+                                    millis() - myChrono, myLoops));
+
+        myUpdates++;
+        if (myUpdates < 4)
+        {
+            update();
+        }
+        else
+        {
+            Serial.println("=== ");
+            Serial.println();
+        }
+    }
+}
@@ -0,0 +1,128 @@
+///
+/// @file Arduino.h
+/// @brief Host stand-in for the Arduino core
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Only what the library uses, with a simulated clock and pins, see Host.h
+///
+
+#ifndef HOST_ARDUINO_h
+#define HOST_ARDUINO_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define RISING 3
+#define FALLING 4
+#define CHANGE 5
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define PI 3.1415926535897932384626433832795
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define digitalPinToInterrupt(pin) (pin)
+#define constrain(amount, low, high) ((amount) < (low) ? (low) : ((amount) > (high) ? (high) : (amount)))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+///
+/// @brief String, subset
+///
+class String
+{
+  public:
+    String() {}
+    String(const char * text) : _s(text ? text : "") {}
+    String(const std::string & text) : _s(text) {}
+    String(char character) : _s(1, character) {}
+    String(int value) : _s(std::to_string(value)) {}
+    String(unsigned int value) : _s(std::to_string(value)) {}
+    String(long value) : _s(std::to_string(value)) {}
+    String(unsigned long value) : _s(std::to_string(value)) {}
+
+    unsigned int length() const { return _s.size(); }
+    char charAt(unsigned int index) const { return (index < _s.size()) ? _s[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    const char * c_str() const { return _s.c_str(); }
+
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from > _s.size())
+        {
+            return String();
+        }
+        if (to > _s.size())
+        {
+            to = _s.size();
+        }
+        if (to < from)
+        {
+            to = from;
+        }
+        return String(_s.substr(from, to - from));
+    }
+    String substring(unsigned int from) const { return substring(from, _s.size()); }
+
+    void toCharArray(char * buffer, unsigned int size) const
+    {
+        if (size > 0)
+        {
+            strncpy(buffer, _s.c_str(), size);
+            buffer[size - 1] = 0;
+        }
+    }
+
+    String & operator+=(const String & other) { _s += other._s; return *this; }
+    String & operator+=(const char * other) { _s += other; return *this; }
+    String & operator+=(char other) { _s += other; return *this; }
+    friend String operator+(const String & a, const String & b) { return String(a._s + b._s); }
+    bool operator==(const String & other) const { return _s == other._s; }
+
+  private:
+    std::string _s;
+};
+
+///
+/// @brief Serial, output to stdout
+///
+struct HardwareSerial
+{
+    void begin(long) {}
+    void print(const String & text) { fputs(text.c_str(), stdout); }
+    void println(const String & text) { puts(text.c_str()); }
+    void println() { puts(""); }
+};
+extern HardwareSerial Serial;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t interrupt, void (*isr)(), int mode);
+void detachInterrupt(uint8_t interrupt);
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+long map(long x, long fromLow, long fromHigh, long toLow, long toHigh);
+
+#endif // HOST_ARDUINO_h
@@ -0,0 +1,131 @@
+///
+/// @file Host.cpp
+/// @brief Simulated board for host tests
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+
+#include "Host.h"
+#include "SPI.h"
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+std::vector<uint8_t> hostSpiLog;
+std::vector<uint8_t> hostPinLog;
+uint32_t hostBusyDuration = 20;
+
+static uint64_t hostMicros = 0;
+static uint64_t busyEnd = 0;
+static bool busyLow = false;
+static void (*busyIsr)() = 0;
+
+// Release BUSY once its duration is over
+static void advance(uint32_t us)
+{
+    hostMicros += us;
+    if (busyLow and (hostMicros >= busyEnd))
+    {
+        busyLow = false;
+        if (busyIsr != 0)
+        {
+            busyIsr();
+        }
+    }
+}
+
+void hostClear()
+{
+    hostSpiLog.clear();
+    hostPinLog.clear();
+}
+
+uint32_t hostHash(const std::vector<uint8_t> & log)
+{
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (uint8_t value : log)
+    {
+        hash = (hash ^ value) * 16777619u;
+    }
+    return hash;
+}
+
+uint32_t millis()
+{
+    advance(50);
+    return hostMicros / 1000;
+}
+
+uint32_t micros()
+{
+    advance(1);
+    return hostMicros;
+}
+
+void delay(uint32_t ms)
+{
+    advance(ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    advance(us);
+}
+
+void yield()
+{
+    advance(10);
+}
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    hostPinLog.push_back(pin);
+    hostPinLog.push_back(value);
+
+    busyLow = true;
+    busyEnd = (hostBusyDuration == 0xffffffff) ? UINT64_MAX : hostMicros + (uint64_t)hostBusyDuration * 1000;
+}
+
+int digitalRead(uint8_t)
+{
+    advance(5);
+    return busyLow ? LOW : HIGH;
+}
+
+void attachInterrupt(uint8_t, void (*isr)(), int)
+{
+    busyIsr = isr;
+}
+
+void detachInterrupt(uint8_t)
+{
+    busyIsr = 0;
+}
+
+long map(long x, long fromLow, long fromHigh, long toLow, long toHigh)
+{
+    return (x - fromLow) * (toHigh - toLow) / (fromHigh - fromLow) + toLow;
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+    hostSpiLog.push_back(data);
+    advance(1);
+    return 0;
+}
+
+void SPIClass::transfer(void * buffer, size_t count)
+{
+    uint8_t * bytes = (uint8_t *)buffer;
+    for (size_t i = 0; i < count; i++)
+    {
+        hostSpiLog.push_back(bytes[i]);
+        bytes[i] = 0xff;
+    }
+    advance(count / 4);
+}
@@ -0,0 +1,35 @@
+///
+/// @file Host.h
+/// @brief Simulated board for host tests
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Clock advanced by the calls only, deterministic
+/// @n BUSY pulled LOW on every pin write and released after hostBusyDuration,
+/// with the interrupt attached to BUSY raised on release
+///
+
+#ifndef HOST_h
+#define HOST_h
+
+#include <vector>
+#include "Arduino.h"
+
+extern std::vector<uint8_t> hostSpiLog; ///< Bytes sent on SPI
+extern std::vector<uint8_t> hostPinLog; ///< Pin writes, pin and value
+extern uint32_t hostBusyDuration; ///< BUSY LOW duration, ms, 0xffffffff = stuck
+
+///
+/// @brief Clear logs
+///
+void hostClear();
+
+///
+/// @brief Hash of a log
+/// @param log bytes
+/// @return hash
+///
+uint32_t hostHash(const std::vector<uint8_t> & log);
+
+#endif // HOST_h
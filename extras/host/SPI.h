@@ -0,0 +1,45 @@
+///
+/// @file SPI.h
+/// @brief Host stand-in for the Arduino SPI library
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Sent bytes logged, see Host.h
+///
+
+#ifndef HOST_SPI_h
+#define HOST_SPI_h
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0
+
+struct SPISettings
+{
+    SPISettings() {}
+    SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+struct SPIClass
+{
+    void begin() {}
+    void end() {}
+    void beginTransaction(SPISettings) {}
+    void endTransaction() {}
+
+    ///
+    /// @brief Send one byte
+    /// @return received byte, 0
+    ///
+    uint8_t transfer(uint8_t data);
+
+    ///
+    /// @brief Send a buffer
+    /// @note As on boards, the sent bytes are replaced with the received ones, 0xff
+    ///
+    void transfer(void * buffer, size_t count);
+};
+extern SPIClass SPI;
+
+#endif // HOST_SPI_h
@@ -0,0 +1,147 @@
+///
+/// @file Test_Flush.cpp
+/// @brief Host test of the update sequences
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Checks, for each screen
+/// * flush() leaves the frame-buffer unchanged, despite SPI.transfer() overwriting what it sends
+/// * flushAsync() and poll() send the same bytes and toggle the same pins as flush(), then call the callback once
+/// * a stuck BUSY stops the update after the timeout, with RESULT_ERROR
+///
+/// @n Prints the hashes of the SPI and pin logs of flush(), to be compared between configurations
+///
+
+#include "Host.h"
+#include "PDLS_EXT3_Basic.h"
+
+static uint8_t failures = 0;
+static uint8_t completed = 0;
+
+static void check(bool condition, uint16_t type, const char * text)
+{
+    if (not condition)
+    {
+        printf("%04x FAIL %s\n", type, text);
+        failures++;
+    }
+}
+
+static void onDone()
+{
+    completed++;
+}
+
+// Same drawing for a given seed
+static void draw(Screen_EPD_EXT3 & screen, uint32_t seed)
+{
+    const uint16_t colours[] = {myColours.black, myColours.white, myColours.red, myColours.grey, myColours.darkRed};
+    uint16_t x = screen.screenSizeX();
+    uint16_t y = screen.screenSizeY();
+
+    for (uint8_t i = 0; i < 40; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        uint16_t colour = colours[(seed >> 8) % 5];
+        uint16_t x0 = (seed >> 12) % x;
+        uint16_t y0 = (seed >> 20) % y;
+
+        if (i % 2)
+        {
+            screen.circle(x0, y0, 1 + (seed >> 4) % 40, colour);
+        }
+        else
+        {
+            screen.rectangle(x0, y0, x0 + (seed >> 6) % 60, y0 + (seed >> 14) % 60, colour);
+        }
+    }
+}
+
+static void testScreen(eScreen_EPD_EXT3_t type)
+{
+    uint16_t code = type;
+
+    // flush()
+    hostBusyDuration = 20;
+    Screen_EPD_EXT3 blocking(type, boardRaspberryPiPico_RP2040);
+    blocking.begin();
+    draw(blocking, code);
+
+    uint16_t x = blocking.screenSizeX();
+    uint16_t y = blocking.screenSizeY();
+    std::vector<uint16_t> pixels;
+    for (uint16_t j = 0; j < y; j++)
+    {
+        for (uint16_t i = 0; i < x; i++)
+        {
+            pixels.push_back(blocking.readPixel(i, j));
+        }
+    }
+
+    hostClear();
+    uint32_t chrono = millis();
+    blocking.flush();
+    chrono = millis() - chrono;
+    std::vector<uint8_t> spi = hostSpiLog;
+    std::vector<uint8_t> pins = hostPinLog;
+    check(blocking.getUpdateResult() == RESULT_SUCCESS, code, "flush() result");
+
+    bool same = true;
+    for (uint16_t j = 0; j < y; j++)
+    {
+        for (uint16_t i = 0; i < x; i++)
+        {
+            same &= (pixels[(uint32_t)j * x + i] == blocking.readPixel(i, j));
+        }
+    }
+    check(same, code, "frame-buffer changed by flush()");
+
+    // flushAsync() and poll()
+    Screen_EPD_EXT3 async(type, boardRaspberryPiPico_RP2040);
+    async.begin();
+    draw(async, code);
+    async.onComplete(onDone);
+    completed = 0;
+
+    hostClear();
+    check(async.flushAsync() == RESULT_SUCCESS, code, "flushAsync() start");
+    check(async.flushAsync() == RESULT_ERROR, code, "flushAsync() during update");
+    uint32_t polls = 0;
+    while (async.poll() and (polls < 100000))
+    {
+        delay(1);
+        polls++;
+    }
+    check(not async.isBusy(), code, "poll() completion");
+    check(completed == 1, code, "onComplete() callback");
+    check(async.getUpdateResult() == RESULT_SUCCESS, code, "flushAsync() result");
+    check(hostSpiLog == spi, code, "SPI bytes of flushAsync() and flush()");
+    check(hostPinLog == pins, code, "pins of flushAsync() and flush()");
+
+    // Timeout, first wait stopped after 500 ms
+    hostBusyDuration = 0xffffffff;
+    blocking.setBusyWait(0, 500);
+    uint32_t timeout = millis();
+    blocking.flush();
+    timeout = millis() - timeout;
+    check(blocking.getUpdateResult() == RESULT_ERROR, code, "timeout result");
+    check(timeout < chrono + 500 + 100, code, "timeout duration");
+
+    hostBusyDuration = 20;
+    blocking.flush();
+    check(blocking.getUpdateResult() == RESULT_SUCCESS, code, "flush() after timeout");
+
+    printf("%04x spi=%08x pins=%08x\n", code, hostHash(spi), hostHash(pins));
+}
+
+int main()
+{
+    testScreen(eScreen_EPD_EXT3_154);
+    testScreen(eScreen_EPD_EXT3_417);
+    testScreen(eScreen_EPD_EXT3_565);
+    testScreen(eScreen_EPD_EXT3_969);
+    testScreen(eScreen_EPD_EXT3_B98);
+
+    return (failures > 0) ? 1 : 0;
+}
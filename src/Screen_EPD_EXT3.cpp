@@ -27,6 +27,14 @@
 #include "SPI.h"
 #include "Screen_EPD_EXT3.h"
 
+#if (FAST_PIN_MODE == USE_FAST_PIN_REGISTER) and !defined(ENERGIA)
+#if defined(ARDUINO_ARCH_ESP32)
+#include "soc/gpio_reg.h"
+#elif defined(ARDUINO_ARCH_RP2040) and !defined(ARDUINO_ARCH_MBED)
+#include "hardware/structs/sio.h"
+#endif // ARDUINO_ARCH
+#endif // FAST_PIN_MODE
+
 #if defined(ENERGIA)
 ///
 /// @brief Proxy for SPISettings
@@ -191,6 +199,25 @@ void Screen_EPD_EXT3::begin()
             break;
     }
 
+    // Addressing, per layout
+    // According to 11.98 inch Spectra Application Note
+    // Large screens combine two half-screens, each row split across both halves
+    switch (_codeSize)
+    {
+        case 0x96: // 9.69"
+        case 0xB9: // 11.98"
+
+            _addressStride = _bufferSizeH >> 1;
+            _addressSplit = _screenSizeH >> 1;
+            break;
+
+        default:
+
+            _addressStride = _bufferSizeH;
+            _addressSplit = 0xffff; // no second half
+            break;
+    }
+
 #if defined(BOARD_HAS_PSRAM) // ESP32 PSRAM specific case
 
     if (_newImage == 0)
@@ -228,6 +255,17 @@ void Screen_EPD_EXT3::begin()
     }
     memset(_newImage, 0x00, _pageColourSize * _bufferDepth);
 
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+    // Tiles of 8 rows by 8 bytes
+    _dirtySizeX = (_screenSizeV + 7) >> 3;
+    _dirtySizeY = (_screenSizeH + 63) >> 6;
+    if (_dirtyMap == 0)
+    {
+        _dirtyMap = new uint8_t[((uint32_t)_dirtySizeX * _dirtySizeY + 7) >> 3];
+    }
+    resetDirty();
+#endif // DIRTY_MODE
+
     // Initialise the /CS pins
     pinMode(_pin.panelCS, OUTPUT);
     digitalWrite(_pin.panelCS, HIGH); // CS# = 1
@@ -251,6 +289,11 @@ void Screen_EPD_EXT3::begin()
         digitalWrite(_pin.panelCSS, HIGH);
     }
 
+    // Control pins for commands
+    _fastPinBegin(_fastDC, _pin.panelDC);
+    _fastPinBegin(_fastCS, _pin.panelCS);
+    _fastPinBegin(_fastCSS, _pin.panelCSS);
+
     // Initialise slave Flash /CS as HIGH
     if (_pin.flashCSS != NOT_CONNECTED)
     {
@@ -334,9 +377,10 @@ void Screen_EPD_EXT3::begin()
 
     _penSolid = false;
     _invert = false;
+    _inkValid = false;
 
     // Report
-    Serial.println(formatString("= Screen %s %ix%i", WhoAmI(), screenSizeX(), screenSizeY()));
+    Serial.println(formatString("= Screen %s %ix%i", WhoAmI().c_str(), screenSizeX(), screenSizeY()));
     Serial.println(formatString("= PDLS v%i", SCREEN_EPD_EXT3_RELEASE));
 
     clear();
@@ -398,464 +442,860 @@ void Screen_EPD_EXT3::flush()
     flushMode(UPDATE_GLOBAL);
 }
 
+#if (BUSY_WAIT_MODE == USE_BUSY_INTERRUPT)
+// Flags of the screens waiting for rising edge of BUSY, one routine per slot
+static volatile bool * busyEdge[BUSY_INTERRUPT_SLOTS] = { 0 };
+
+static void setBusyEdge0()
+{
+    *busyEdge[0] = true;
+}
+
+#if (BUSY_INTERRUPT_SLOTS > 1)
+static void setBusyEdge1()
+{
+    *busyEdge[1] = true;
+}
+#endif // BUSY_INTERRUPT_SLOTS
+
+static void (* const setBusyEdge[BUSY_INTERRUPT_SLOTS])() =
+{
+    setBusyEdge0,
+#if (BUSY_INTERRUPT_SLOTS > 1)
+    setBusyEdge1,
+#endif // BUSY_INTERRUPT_SLOTS
+};
+#endif // BUSY_WAIT_MODE
+
 void Screen_EPD_EXT3::_flushGlobal()
 {
-    uint8_t * blackBuffer = _newImage;
-    uint8_t * redBuffer = _newImage + _pageColourSize;
+    // Pending flushAsync() completed first
+    while (poll());
 
-    // Three groups:
-    // + small: up to 4.37 included
-    // + medium: 5.65, 5.81 and 7.4
-    // + large: 9.69 and 11,98
-    // switch..case does not allow variable declarations
-    //
-    if ((_codeSize == 0x56) or (_codeSize == 0x58) or (_codeSize == 0x74))
+    // Same steps as flushAsync(), with blocking waits
+    _flushResult = RESULT_SUCCESS;
+    _flushStep = 1;
+    while (_flushStep > 0)
     {
-        _reset(200, 20, 200, 50, 5);
+        _flushGlobalStep();
 
-        // Send image data
-        if (_codeSize == 0x56)
+        if (_flushDelay > 0)
         {
-            uint8_t data1_565[] = {0x00, 0x37, 0x00, 0x00, 0x57, 0x02}; // DUW
-            _sendIndexData(0x13, data1_565, 6); // DUW
-            uint8_t data2_565[] = {0x00, 0x37, 0x00, 0x97}; // DRFW
-            _sendIndexData(0x90, data2_565, 4); // DRFW
-            uint8_t data3_565[] = {0x37, 0x00, 0x14}; // RAM_RW
-            _sendIndexData(0x12, data3_565, 3); // RAM_RW
+            delay_ms(_flushDelay);
         }
-        else if (_codeSize == 0x58)
+        if (_flushBusy)
         {
-            uint8_t data1_565[] = {0x00, 0x1f, 0x50, 0x00, 0x1f, 0x03}; // DUW
-            _sendIndexData(0x13, data1_565, 6); // DUW
-            uint8_t data2_565[] = {0x00, 0x1f, 0x00, 0xc9}; // DRFW
-            _sendIndexData(0x90, data2_565, 4); // DRFW
-            uint8_t data3_565[] = {0x1f, 0x50, 0x14}; // RAM_RW
-            _sendIndexData(0x12, data3_565, 3); // RAM_RW
-        }
-        else if (_codeSize == 0x74)
-        {
-            uint8_t data1_565[] = {0x00, 0x3b, 0x00, 0x00, 0x1f, 0x03}; // DUW
-            _sendIndexData(0x13, data1_565, 6); // DUW
-            uint8_t data2_565[] = {0x00, 0x3b, 0x00, 0xc9}; // DRFW
-            _sendIndexData(0x90, data2_565, 4); // DRFW
-            uint8_t data3_565[] = {0x3b, 0x00, 0x14}; // RAM_RW
-            _sendIndexData(0x12, data3_565, 3); // RAM_RW
-        }
+            // Sleep until close to predicted end, then poll
+            uint32_t sleep = _predictSleep();
+            if (_busyHook != 0)
+            {
+                uint32_t chrono = millis();
+                while (millis() - chrono < sleep)
+                {
+                    _busyHook();
+                }
+            }
+            else if (sleep > 0)
+            {
+                delay(sleep);
+            }
 
-        if (_codeType == 0x0B)
-        {
-            // y1 = 7 - (y1 % 8);
-            uint8_t dtcl = 0x08; // 0=IST, 8=IST
-            _sendIndexData(0x01, &dtcl, 1); // DCTL 0x10 of MTP
+            if (_waitBusy())
+            {
+                // Timeout, panel turned off
+                _flushResult = RESULT_ERROR;
+                _flushStep = 0xff;
+            }
+            else
+            {
+                _predictLearn();
+            }
         }
+    }
+}
 
-        _sendIndexData(0x10, blackBuffer, _frameSize); // First frame
+uint8_t Screen_EPD_EXT3::flushAsync()
+{
+    if (_flushStep > 0)
+    {
+        return RESULT_ERROR;
+    }
 
-        if (_codeSize == 0x56)
-        {
-            uint8_t data3_565[] = {0x37, 0x00, 0x14}; // RAM_RW
-            _sendIndexData(0x12, data3_565, 3); // RAM_RW
-        }
-        else if (_codeSize == 0x58)
-        {
-            uint8_t data3_565[] = {0x1f, 0x50, 0x14}; // RAM_RW
-            _sendIndexData(0x12, data3_565, 3); // RAM_RW
-        }
-        else if (_codeSize == 0x74)
-        {
-            uint8_t data3_565[] = {0x3b, 0x00, 0x14}; // RAM_RW
-            _sendIndexData(0x12, data3_565, 3); // RAM_RW
-        }
-        _sendIndexData(0x11, redBuffer, _frameSize); // Second frame
-
-        // Initial COG
-        uint8_t data4_565[] = {0x7d};
-        _sendIndexData(0x05, data4_565, 1);
-        delay_ms(200);
-        uint8_t data5_565[] = {0x00};
-        _sendIndexData(0x05, data5_565, 1);
-        delay_ms(10);
-        uint8_t data6_565[] = {0x3f};
-        _sendIndexData(0xc2, data6_565, 1);
-        delay_ms(1);
-        uint8_t data7_565[] = {0x00};
-        _sendIndexData(0xd8, data7_565, 1); // MS_SYNC mtp_0x1d
-        uint8_t data8_565[] = {0x00};
-        _sendIndexData(0xd6, data8_565, 1); // BVSS mtp_0x1e
-        uint8_t data9_565[] = {0x10};
-        _sendIndexData(0xa7, data9_565, 1);
-        delay_ms(100);
-        _sendIndexData(0xa7, data5_565, 1);
-        delay_ms(100);
-        // uint8_t data10_565[] = {0x00, 0x02 };
-        if (_codeSize == 0x56)
-        {
-            uint8_t data10_565[] = {0x00, 0x02}; // OSC
-            _sendIndexData(0x03, data10_565, 2); // OSC mtp_0x12
-        }
-        else if (_codeSize == 0x58)
-        {
-            uint8_t data10_565[] = {0x00, 0x01}; // OSC
-            _sendIndexData(0x03, data10_565, 2); // OSC mtp_0x12
-        }
-        else if (_codeSize == 0x74)
-        {
-            uint8_t data10_565[] = {0x00, 0x01}; // OSC
-            _sendIndexData(0x03, data10_565, 2); // OSC mtp_0x12
-        }
-        _sendIndexData(0x44, data5_565, 1);
-        uint8_t data11_565[] = {0x80};
-        _sendIndexData(0x45, data11_565, 1);
-        _sendIndexData(0xa7, data9_565, 1);
-        delay_ms(100);
-        _sendIndexData(0xa7, data7_565, 1);
-        delay_ms(100);
-        uint8_t data12_565[] = {0x06};
-        _sendIndexData(0x44, data12_565, 1);
-        uint8_t data13_565[] = {0x82};
-        data13_565[0] = _temperature * 2 + 0x50; // _temperature
-        _sendIndexData(0x45, data13_565, 1); // Temperature 0x82@25C
-        _sendIndexData(0xa7, data9_565, 1);
-        delay_ms(100);
-        _sendIndexData(0xa7, data7_565, 1);
-        delay_ms(100);
-        uint8_t data14_565[] = {0x25};
-        _sendIndexData(0x60, data14_565, 1); // TCON mtp_0x0b
-        // uint8_t data15_565[] = {0x01 };
-        if (_codeSize == 0x56)
-        {
-            uint8_t data15_565[] = {0x01}; // STV_DIR
-            _sendIndexData(0x61, data15_565, 1); // STV_DIR mtp_0x1c
-        }
-        else if (_codeSize == 0x58)
-        {
-            uint8_t data15_565[] = {0x00}; // STV_DIR
-            _sendIndexData(0x61, data15_565, 1); // STV_DIR mtp_0x1c
-        }
-        else if (_codeSize == 0x74)
-        {
-            uint8_t data15_565[] = {0x00}; // STV_DIR
-            _sendIndexData(0x61, data15_565, 1); // STV_DIR mtp_0x1c
-        }
-        uint8_t data16_565[] = {0x00};
-        _sendIndexData(0x01, data16_565, 1); // DCTL mtp_0x10
-        uint8_t data17_565[] = {0x00};
-        _sendIndexData(0x02, data17_565, 1); // VCOM mtp_0x11
+    if (checkTemperatureMode(UPDATE_GLOBAL) == UPDATE_NONE)
+    {
+        Serial.println("* PDLS - UPDATE_NONE invoked");
+        return RESULT_ERROR;
+    }
 
-        // DC-DC soft-start
-        uint8_t index51_565[] = {0x50, 0x01, 0x0a, 0x01};
-        _sendIndexData(0x51, &index51_565[0], 2);
-        uint8_t index09_565[] = {0x1f, 0x9f, 0x7f, 0xff};
+    _flushResult = RESULT_SUCCESS;
+    _flushStep = 1;
+    _flushDelay = 0;
+    _flushBusy = false;
+    poll();
+    return RESULT_SUCCESS;
+}
 
-        for (int value = 1; value <= 4; value++)
-        {
-            _sendIndexData(0x09, &index09_565[0], 1);
-            index51_565[1] = value;
-            _sendIndexData(0x51, &index51_565[0], 2);
-            _sendIndexData(0x09, &index09_565[1], 1);
-            delay_ms(2);
-        }
-        for (int value = 1; value <= 10; value++)
+bool Screen_EPD_EXT3::poll()
+{
+    while (_flushStep > 0)
+    {
+        // Pending wait
+        if ((_flushDelay > 0) and (millis() - _flushChrono < _flushDelay))
         {
-            _sendIndexData(0x09, &index09_565[0], 1);
-            index51_565[3] = value;
-            _sendIndexData(0x51, &index51_565[2], 2);
-            _sendIndexData(0x09, &index09_565[1], 1);
-            delay_ms(2);
+            return true;
         }
-        for (int value = 3; value <= 10; value++)
+        if (_flushBusy)
         {
-            _sendIndexData(0x09, &index09_565[2], 1);
-            index51_565[3] = value;
-            _sendIndexData(0x51, &index51_565[2], 2);
-            _sendIndexData(0x09, &index09_565[3], 1);
-            delay_ms(2);
+            // No need to poll before predicted end
+            if (_predictSleep() > 0)
+            {
+                return true;
+            }
+
+            if (digitalRead(_pin.panelBusy) == HIGH)
+            {
+                _predictLearn();
+            }
+            else if (millis() - _flushChrono - _flushDelay < _busyTimeout)
+            {
+                return true;
+            }
+            else
+            {
+                // Timeout, panel turned off
+                _flushResult = RESULT_ERROR;
+                _flushStep = 0xff;
+            }
         }
-        for (int value = 9; value >= 2; value--)
+
+        _flushGlobalStep();
+
+        if (_flushStep == 0)
         {
-            _sendIndexData(0x09, &index09_565[2], 1);
-            index51_565[2] = value;
-            _sendIndexData(0x51, &index51_565[2], 2);
-            _sendIndexData(0x09, &index09_565[3], 1);
-            delay_ms(2);
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+            // Frame-buffer not displayed on timeout
+            if (_flushResult == RESULT_SUCCESS)
+            {
+                resetDirty();
+            }
+#endif // DIRTY_MODE
+            if (_flushCallback != 0)
+            {
+                _flushCallback();
+            }
         }
-        _sendIndexData(0x09, &index09_565[3], 1);
-        delay_ms(10);
+    }
+    return false;
+}
+
+bool Screen_EPD_EXT3::isBusy()
+{
+    return (_flushStep > 0);
+}
+
+void Screen_EPD_EXT3::onComplete(void (*callback)())
+{
+    _flushCallback = callback;
+}
+
+void Screen_EPD_EXT3::setBusyWait(void (*hook)(), uint32_t timeout)
+{
+    _busyHook = hook;
+    _busyTimeout = timeout;
+}
+
+uint8_t Screen_EPD_EXT3::getUpdateResult()
+{
+    return _flushResult;
+}
+
+bool Screen_EPD_EXT3::_waitBusy()
+{
+    uint32_t chrono = millis();
+    bool result = false;
+
+#if (BUSY_WAIT_MODE == USE_BUSY_INTERRUPT)
+    // Rising edge caught even while the hook sleeps
+    // Polling if all slots are used by other screens
+    uint8_t slot = 0;
+    noInterrupts();
+    while ((slot < BUSY_INTERRUPT_SLOTS) and (busyEdge[slot] != 0))
+    {
+        slot++;
+    }
+    if (slot < BUSY_INTERRUPT_SLOTS)
+    {
+        busyEdge[slot] = &_busyEdge;
+    }
+    interrupts();
 
-        // Display Refresh Start
-        while (digitalRead(_pin.panelBusy) != HIGH)
+    _busyEdge = false;
+    if (slot < BUSY_INTERRUPT_SLOTS)
+    {
+        attachInterrupt(digitalPinToInterrupt(_pin.panelBusy), setBusyEdge[slot], RISING);
+    }
+    while ((not _busyEdge) and (digitalRead(_pin.panelBusy) != HIGH))
+#else
+    while (digitalRead(_pin.panelBusy) != HIGH)
+#endif // BUSY_WAIT_MODE
+    {
+        if (millis() - chrono >= _busyTimeout)
         {
-            delay(100);
+            Serial.println("* PDLS - BUSY timeout");
+            result = true;
+            break;
         }
-        uint8_t data18_565[] = {0x3c};
-        _sendIndexData(0x15, data18_565, 1); //Display Refresh
-        delay_ms(5);
 
-        // DC-DC off
-        while (digitalRead(_pin.panelBusy) != HIGH)
+        if (_busyHook != 0)
         {
-            delay(100);
+            _busyHook();
         }
-        uint8_t data19_565[] = {0x7f};
-        _sendIndexData(0x09, data19_565, 1);
-        uint8_t data20_565[] = {0x7d};
-        _sendIndexData(0x05, data20_565, 1);
-        _sendIndexData(0x09, data5_565, 1);
-        delay_ms(200);
-
-        while (digitalRead(_pin.panelBusy) != HIGH)
+        else
         {
-            delay(100);
+            delay(BUSY_POLL_PERIOD);
         }
-        digitalWrite(_pin.panelDC, LOW);
-        digitalWrite(_pin.panelCS, LOW);
-        digitalWrite(_pin.panelReset, LOW);
-        // digitalWrite(PNLON_PIN, LOW); // PANEL_OFF# = 0
     }
-    else if ((_codeSize == 0x96) or (_codeSize == 0xB9))
+
+#if (BUSY_WAIT_MODE == USE_BUSY_INTERRUPT)
+    if (slot < BUSY_INTERRUPT_SLOTS)
     {
-        _reset(200, 20, 200, 200, 5);
+        detachInterrupt(digitalPinToInterrupt(_pin.panelBusy));
+        busyEdge[slot] = 0;
+    }
+#endif // BUSY_WAIT_MODE
 
-        // Send image data
-        if (_codeSize == 0x96)
-        {
-            uint8_t data1_970[] = {0x00, 0x3b, 0x00, 0x00, 0x9f, 0x02}; // DUW
-            _sendIndexData(0x13, data1_970, 6); // DUW for Both Master and Slave
-            uint8_t data2_970[] = {0x00, 0x3b, 0x00, 0xa9}; // DRFW
-            _sendIndexData(0x90, data2_970, 4); // DRFW for Both Master and Slave
-        }
-        else if (_codeSize == 0xB9)
-        {
-            uint8_t data1_970[] = {0x00, 0x3b, 0x00, 0x00, 0x1f, 0x03}; // DUW
-            _sendIndexData(0x13, data1_970, 6); // DUW for Both Master and Slave
-            uint8_t data2_970[] = {0x00, 0x3b, 0x00, 0xc9}; // DRFW
-            _sendIndexData(0x90, data2_970, 4); // DRFW for Both Master and Slave
-        }
+    return result;
+}
 
-        uint8_t data3_970[] = {0x3b, 0x00, 0x14};
+void Screen_EPD_EXT3::_flushWait(uint32_t ms, bool flagBusy, uint8_t phase)
+{
+    _flushChrono = millis();
+    _flushDelay = ms;
+    _flushBusy = flagBusy;
+    _flushPhase = phase;
+}
 
-        if (_codeType == 0x0B)
+uint32_t Screen_EPD_EXT3::getFlushETA()
+{
+    uint8_t band = _predictBand();
+    uint32_t result = 0;
+
+    for (uint8_t phase = FLUSH_PHASE_REFRESH; phase <= FLUSH_PHASE_OFF; phase++)
+    {
+        uint32_t duration = _predictDuration[phase - 1][band];
+        if (duration == 0)
         {
-            uint8_t dtcl = 0x08; // 0=IST, 8=IST
-            _sendIndexData(0x01, &dtcl, 1); // DCTL 0x10 of MTP
+            return 0; // unknown
         }
 
-        // Master
-        _sendIndexDataMaster(0x12, data3_970, 3); // RAM_RW
-
-        _sendIndexDataMaster(0x10, blackBuffer, _frameSize); // First frame
-
-        _sendIndexDataMaster(0x12, data3_970, 3); // RAM_RW
-
-        _sendIndexDataMaster(0x11, redBuffer, _frameSize); // Second frame
-
-        // Slave
-        _sendIndexDataSlave(0x12, data3_970, 3); // RAM_RW
-        _sendIndexDataSlave(0x10, blackBuffer + _frameSize, _frameSize); // First frame
-
-        _sendIndexDataSlave(0x12, data3_970, 3); // RAM_RW
-        _sendIndexDataSlave(0x11, redBuffer + _frameSize, _frameSize); // Second frame
-
-        // Initial COG
-        uint8_t data4_970[] = {0x7d};
-        _sendIndexData(0x05, data4_970, 1);
-        delay_ms(200);
-        uint8_t data5_970[] = {0x00};
-        _sendIndexData(0x05, data5_970, 1);
-        delay_ms(10);
-        uint8_t data6_970[] = {0x3f};
-        _sendIndexData(0xc2, data6_970, 1);
-        delay_ms(1);
-        uint8_t data7_970[] = {0x80};
-        _sendIndexData(0xd8, data7_970, 1); // MS_SYNC
-        uint8_t data8_970[] = {0x00};
-        _sendIndexData(0xd6, data8_970, 1); // BVSS
-        uint8_t data9_970[] = {0x10};
-        _sendIndexData(0xa7, data9_970, 1);
-        delay_ms(100);
-        _sendIndexData(0xa7, data5_970, 1);
-        delay_ms(100);
-
-        // --- 9.69 and 11.9 specific
-        if (_codeSize == 0x96)
+        if ((_flushStep == 0) or (_flushPhase < phase))
         {
-            uint8_t data10_970[] = {0x00, 0x11}; // OSC
-            _sendIndexData(0x03, data10_970, 2); // OSC
+            result += duration;
         }
-        else if (_codeSize == 0xB9)
+        else if (_flushPhase == phase)
         {
-            uint8_t data10_970[] = {0x00, 0x12}; // OSC
-            _sendIndexData(0x03, data10_970, 2); // OSC
+            uint32_t elapsed = millis() - _flushChrono;
+            result += (elapsed < duration) ? duration - elapsed : 0;
         }
+    }
+    return max(result, (uint32_t)1); // 0 = unknown, overrun = 1
+}
 
-        _sendIndexDataMaster(0x44, data5_970, 1); // Master
-        uint8_t data11_970[] = {0x80};
-        _sendIndexDataMaster(0x45, data11_970, 1); // Master
-        _sendIndexDataMaster(0xa7, data9_970, 1); // Master
-        delay_ms(100);
-        _sendIndexDataMaster(0xa7, data5_970, 1); // Master
-        delay_ms(100);
-        uint8_t data12_970[] = {0x06};
-        _sendIndexDataMaster(0x44, data12_970, 1); // Master
-        uint8_t data13_970[] = {0x82};
-        // uint8_t data13_970[] = {getTemperature(0x50, 0x82) };
-        data13_970[0] = _temperature * 2 + 0x50; // _temperature
-        _sendIndexDataMaster(0x45, data13_970, 1); // Temperature 0x82@25C   0°C = 0x50, 25°C = 0x82
-        _sendIndexDataMaster(0xa7, data9_970, 1); // Master
-        delay_ms(100);
-        _sendIndexDataMaster(0xa7, data5_970, 1); // Master
-        delay_ms(100);
-
-        _sendIndexDataSlave(0x44, data5_970, 1); // Slave
-        _sendIndexDataSlave(0x45, data11_970, 1); // Slave
-        _sendIndexDataSlave(0xa7, data9_970, 1); // Slave
-        delay_ms(100);
-        _sendIndexDataSlave(0xa7, data5_970, 1); // Slave
-        delay_ms(100);
-        _sendIndexDataSlave(0x44, data12_970, 1); // Slave
-        _sendIndexDataSlave(0x45, data13_970, 1); // Temperature 0x82@25C   0°C = 0x50, 25°C = 0x82
-        _sendIndexDataSlave(0xa7, data9_970, 1); // Slave
-        delay_ms(100);
-        _sendIndexDataSlave(0xa7, data5_970, 1); // Master
-        delay_ms(100);
-
-        uint8_t data14_970[] = {0x25};
-        _sendIndexData(0x60, data14_970, 1); // TCON
-        uint8_t data15_970[] = {0x01};
-        _sendIndexDataMaster(0x61, data15_970, 1); // STV_DIR for Master
-        uint8_t data16_970[] = {0x00};
-        _sendIndexData(0x01, data16_970, 1); // DCTL
-        uint8_t data17_970[] = {0x00};
-        _sendIndexData(0x02, data17_970, 1); // VCOM
-
-        // DC-DC soft-start
-        uint8_t index51_970[] = {0x50, 0x01, 0x0a, 0x01};
-        _sendIndexData(0x51, &index51_970[0], 2);
-        uint8_t index09_970[] = {0x1f, 0x9f, 0x7f, 0xff};
-
-        for (int value = 1; value <= 4; value++)
-        {
-            _sendIndexData(0x09, &index09_970[0], 1);
-            index51_970[1] = value;
-            _sendIndexData(0x51, &index51_970[0], 2);
-            _sendIndexData(0x09, &index09_970[1], 1);
-            delay_ms(2);
-        }
-        for (int value = 1; value <= 10; value++)
+uint8_t Screen_EPD_EXT3::_predictBand()
+{
+    // Bands of 10 °C from -15 °C
+    int16_t band = (_temperature + 15) / 10;
+    return (uint8_t)checkRange(max(band, 0), 0, PREDICTION_BANDS - 1);
+}
+
+uint32_t Screen_EPD_EXT3::_predictSleep()
+{
+#if (REFRESH_PREDICTION == USE_PREDICTION_AVERAGE)
+    if (_flushPhase != FLUSH_PHASE_NONE)
+    {
+        uint32_t duration = _predictDuration[_flushPhase - 1][_predictBand()];
+        duration -= duration * PREDICTION_MARGIN / 100;
+        uint32_t elapsed = millis() - _flushChrono;
+
+        if (elapsed < duration)
         {
-            _sendIndexData(0x09, &index09_970[0], 1);
-            index51_970[3] = value;
-            _sendIndexData(0x51, &index51_970[2], 2);
-            _sendIndexData(0x09, &index09_970[1], 1);
-            delay_ms(2);
+            return duration - elapsed;
         }
-        for (int value = 3; value <= 10; value++)
+    }
+#endif // REFRESH_PREDICTION
+
+    return 0;
+}
+
+void Screen_EPD_EXT3::_predictLearn()
+{
+#if (REFRESH_PREDICTION == USE_PREDICTION_AVERAGE)
+    if (_flushPhase != FLUSH_PHASE_NONE)
+    {
+        uint16_t & average = _predictDuration[_flushPhase - 1][_predictBand()];
+        uint32_t duration = min(millis() - _flushChrono, (uint32_t)0xffff);
+        duration = max(duration, (uint32_t)1); // 0 = unknown
+
+        if (average == 0)
         {
-            _sendIndexData(0x09, &index09_970[2], 1);
-            index51_970[3] = value;
-            _sendIndexData(0x51, &index51_970[2], 2);
-            _sendIndexData(0x09, &index09_970[3], 1);
-            delay_ms(2);
+            average = duration;
         }
-        for (int value = 9; value >= 2; value--)
+        else
         {
-            _sendIndexData(0x09, &index09_970[2], 1);
-            index51_970[2] = value;
-            _sendIndexData(0x51, &index51_970[2], 2);
-            _sendIndexData(0x09, &index09_970[3], 1);
-            delay_ms(2);
+            // Exponential moving average
+            average = (uint16_t)(((uint32_t)average * (PREDICTION_WEIGHT - 1) + duration) / PREDICTION_WEIGHT);
         }
-        _sendIndexData(0x09, &index09_970[3], 1);
-        delay_ms(10);
+    }
+#endif // REFRESH_PREDICTION
+}
 
-        // Display Refresh Start
-        while (digitalRead(_pin.panelBusy) != HIGH)
-        {
-            delay(100);
-        }
-        uint8_t data18_970[] = {0x3c};
-        _sendIndexData(0x15, data18_970, 1); // Display Refresh
-        delay_ms(5);
+void Screen_EPD_EXT3::_flushSoftStart(uint8_t step)
+{
+    // Same sequence as the four loops of DC-DC soft-start, 30 steps
+    uint8_t index09[] = {0x1f, 0x9f, 0x7f, 0xff};
+    uint8_t index51[2];
+    uint8_t first = 0;
 
-        // DC/DC off
-        while (digitalRead(_pin.panelBusy) != HIGH)
-        {
-            delay(100);
-        }
-        uint8_t data19_970[] = {0x7f};
-        _sendIndexData(0x09, data19_970, 1);
-        uint8_t data20_970[] = {0x7d};
-        _sendIndexData(0x05, data20_970, 1);
-        _sendIndexData(0x09, data5_970, 1);
-        delay_ms(200);
-        while (digitalRead(_pin.panelBusy) != HIGH)
+    if (step < 4)
+    {
+        index51[0] = 0x50;
+        index51[1] = step + 1;
+    }
+    else if (step < 14)
+    {
+        index51[0] = 0x0a;
+        index51[1] = step - 3;
+    }
+    else if (step < 22)
+    {
+        first = 2;
+        index51[0] = 0x0a;
+        index51[1] = step - 11;
+    }
+    else
+    {
+        first = 2;
+        index51[0] = 31 - step;
+        index51[1] = 0x0a;
+    }
+
+    _sendIndexData(0x09, &index09[first], 1);
+    _sendIndexData(0x51, index51, 2);
+    _sendIndexData(0x09, &index09[first + 1], 1);
+}
+
+void Screen_EPD_EXT3::_flushGlobalStep()
+{
+    uint8_t * blackBuffer = _newImage;
+    uint8_t * redBuffer = _newImage + _pageColourSize;
+    uint8_t step = _flushStep;
+
+    // Default: next step, without wait
+    _flushWait(0);
+    _flushStep++;
+
+    // Three groups:
+    // + small: up to 4.37 included
+    // + medium: 5.65, 5.81 and 7.4
+    // + large: 9.69 and 11,98
+    //
+    bool flagMedium = (_codeSize == 0x56) or (_codeSize == 0x58) or (_codeSize == 0x74);
+    bool flagLarge = (_codeSize == 0x96) or (_codeSize == 0xB9);
+
+    // Reset, steps 1 to 5
+    if (step <= 5)
+    {
+        // ms1 to ms5 of _reset()
+        uint8_t resets[3][5] = {{5, 5, 10, 5, 5}, {200, 20, 200, 50, 5}, {200, 20, 200, 200, 5}};
+        uint8_t group = flagLarge ? 2 : (flagMedium ? 1 : 0);
+
+        switch (step)
         {
-            delay(100);
+            case 2:
+            case 4:
+
+                digitalWrite(_pin.panelReset, HIGH); // RES# = 1
+                break;
+
+            case 3:
+
+                digitalWrite(_pin.panelReset, LOW);
+                break;
+
+            case 5:
+
+                digitalWrite(_pin.panelCS, HIGH); // CS# = 1
+                if ((flagLarge) and (_pin.panelCSS != NOT_CONNECTED))
+                {
+                    digitalWrite(_pin.panelCSS, HIGH); // CSS# = 1
+                }
+                break;
+
+            default:
+
+                break;
         }
-        digitalWrite(_pin.panelDC, LOW);
-        digitalWrite(_pin.panelCS, LOW);
+        _flushWait(resets[group][step - 1]);
+        return;
+    }
 
-        if (_pin.panelCSS != NOT_CONNECTED)
+    if (flagMedium)
+    {
+        uint8_t data[6];
+
+        switch (step)
         {
-            digitalWrite(_pin.panelCSS, LOW);
+            case 6:
+
+                // Send image data
+                if (_codeSize == 0x56)
+                {
+                    uint8_t data1_565[] = {0x00, 0x37, 0x00, 0x00, 0x57, 0x02}; // DUW
+                    _sendIndexData(0x13, data1_565, 6); // DUW
+                    uint8_t data2_565[] = {0x00, 0x37, 0x00, 0x97}; // DRFW
+                    _sendIndexData(0x90, data2_565, 4); // DRFW
+                }
+                else if (_codeSize == 0x58)
+                {
+                    uint8_t data1_565[] = {0x00, 0x1f, 0x50, 0x00, 0x1f, 0x03}; // DUW
+                    _sendIndexData(0x13, data1_565, 6); // DUW
+                    uint8_t data2_565[] = {0x00, 0x1f, 0x00, 0xc9}; // DRFW
+                    _sendIndexData(0x90, data2_565, 4); // DRFW
+                }
+                else // 0x74
+                {
+                    uint8_t data1_565[] = {0x00, 0x3b, 0x00, 0x00, 0x1f, 0x03}; // DUW
+                    _sendIndexData(0x13, data1_565, 6); // DUW
+                    uint8_t data2_565[] = {0x00, 0x3b, 0x00, 0xc9}; // DRFW
+                    _sendIndexData(0x90, data2_565, 4); // DRFW
+                }
+
+                // RAM_RW
+                if (_codeSize == 0x56)
+                {
+                    data[0] = 0x37;
+                    data[1] = 0x00;
+                }
+                else if (_codeSize == 0x58)
+                {
+                    data[0] = 0x1f;
+                    data[1] = 0x50;
+                }
+                else // 0x74
+                {
+                    data[0] = 0x3b;
+                    data[1] = 0x00;
+                }
+                data[2] = 0x14;
+                _sendIndexData(0x12, data, 3); // RAM_RW
+
+                if (_codeType == 0x0B)
+                {
+                    uint8_t dtcl = 0x08; // 0=IST, 8=IST
+                    _sendIndexData(0x01, &dtcl, 1); // DCTL 0x10 of MTP
+                }
+
+                _sendIndexData(0x10, blackBuffer, _frameSize); // First frame
+                _sendIndexData(0x12, data, 3); // RAM_RW
+                _sendIndexData(0x11, redBuffer, _frameSize); // Second frame
+
+                // Initial COG
+                data[0] = 0x7d;
+                _sendIndexData(0x05, data, 1);
+                _flushWait(200);
+                break;
+
+            case 7:
+
+                data[0] = 0x00;
+                _sendIndexData(0x05, data, 1);
+                _flushWait(10);
+                break;
+
+            case 8:
+
+                data[0] = 0x3f;
+                _sendIndexData(0xc2, data, 1);
+                _flushWait(1);
+                break;
+
+            case 9:
+
+                data[0] = 0x00;
+                _sendIndexData(0xd8, data, 1); // MS_SYNC mtp_0x1d
+                _sendIndexData(0xd6, data, 1); // BVSS mtp_0x1e
+                data[0] = 0x10;
+                _sendIndexData(0xa7, data, 1);
+                _flushWait(100);
+                break;
+
+            case 10:
+            case 12:
+            case 14:
+
+                data[0] = 0x00;
+                _sendIndexData(0xa7, data, 1);
+                _flushWait(100);
+                break;
+
+            case 11:
+
+                data[0] = 0x00;
+                data[1] = (_codeSize == 0x56) ? 0x02 : 0x01; // OSC
+                _sendIndexData(0x03, data, 2); // OSC mtp_0x12
+                _sendIndexData(0x44, data, 1);
+                data[0] = 0x80;
+                _sendIndexData(0x45, data, 1);
+                data[0] = 0x10;
+                _sendIndexData(0xa7, data, 1);
+                _flushWait(100);
+                break;
+
+            case 13:
+
+                data[0] = 0x06;
+                _sendIndexData(0x44, data, 1);
+                data[0] = _temperature * 2 + 0x50; // _temperature
+                _sendIndexData(0x45, data, 1); // Temperature 0x82@25C
+                data[0] = 0x10;
+                _sendIndexData(0xa7, data, 1);
+                _flushWait(100);
+                break;
+
+            case 15:
+
+                data[0] = 0x25;
+                _sendIndexData(0x60, data, 1); // TCON mtp_0x0b
+                data[0] = (_codeSize == 0x56) ? 0x01 : 0x00; // STV_DIR
+                _sendIndexData(0x61, data, 1); // STV_DIR mtp_0x1c
+                data[0] = 0x00;
+                _sendIndexData(0x01, data, 1); // DCTL mtp_0x10
+                _sendIndexData(0x02, data, 1); // VCOM mtp_0x11
+
+                // DC-DC soft-start
+                data[0] = 0x50;
+                data[1] = 0x01;
+                _sendIndexData(0x51, data, 2);
+                _flushCount = 0;
+                break;
+
+            case 16:
+
+                _flushSoftStart(_flushCount);
+                _flushCount++;
+                if (_flushCount < 30)
+                {
+                    _flushStep = 16;
+                }
+                _flushWait(2);
+                break;
+
+            case 17:
+
+                data[0] = 0xff;
+                _sendIndexData(0x09, data, 1);
+
+                // Display Refresh Start
+                _flushWait(10, true);
+                break;
+
+            case 18:
+
+                data[0] = 0x3c;
+                _sendIndexData(0x15, data, 1); //Display Refresh
+
+                // DC-DC off
+                _flushWait(5, true, FLUSH_PHASE_REFRESH);
+                break;
+
+            case 19:
+
+                data[0] = 0x7f;
+                _sendIndexData(0x09, data, 1);
+                data[0] = 0x7d;
+                _sendIndexData(0x05, data, 1);
+                data[0] = 0x00;
+                _sendIndexData(0x09, data, 1);
+                _flushWait(200, true, FLUSH_PHASE_OFF);
+                break;
+
+            default:
+
+                digitalWrite(_pin.panelDC, LOW);
+                digitalWrite(_pin.panelCS, LOW);
+                digitalWrite(_pin.panelReset, LOW);
+                // digitalWrite(PNLON_PIN, LOW); // PANEL_OFF# = 0
+                digitalWrite(_pin.panelCS, HIGH); // CS# = 1
+                _flushStep = 0;
+                break;
         }
+    }
+    else if (flagLarge)
+    {
+        uint8_t data[6];
+        uint8_t data3_970[] = {0x3b, 0x00, 0x14}; // RAM_RW
+        void (Screen_EPD_EXT3::*send)(uint8_t, const uint8_t *, uint32_t);
 
-        digitalWrite(_pin.panelReset, LOW);
-        // digitalWrite(PNLON_PIN, LOW); // PANEL_OFF# = 0
-
-        if (_pin.panelCSS != NOT_CONNECTED)
+        switch (step)
         {
-            digitalWrite(_pin.panelCSS, HIGH); // CSS# = 1
+            case 6:
+
+                // Send image data
+                if (_codeSize == 0x96)
+                {
+                    uint8_t data1_970[] = {0x00, 0x3b, 0x00, 0x00, 0x9f, 0x02}; // DUW
+                    _sendIndexData(0x13, data1_970, 6); // DUW for Both Master and Slave
+                    uint8_t data2_970[] = {0x00, 0x3b, 0x00, 0xa9}; // DRFW
+                    _sendIndexData(0x90, data2_970, 4); // DRFW for Both Master and Slave
+                }
+                else // 0xB9
+                {
+                    uint8_t data1_970[] = {0x00, 0x3b, 0x00, 0x00, 0x1f, 0x03}; // DUW
+                    _sendIndexData(0x13, data1_970, 6); // DUW for Both Master and Slave
+                    uint8_t data2_970[] = {0x00, 0x3b, 0x00, 0xc9}; // DRFW
+                    _sendIndexData(0x90, data2_970, 4); // DRFW for Both Master and Slave
+                }
+
+                if (_codeType == 0x0B)
+                {
+                    uint8_t dtcl = 0x08; // 0=IST, 8=IST
+                    _sendIndexData(0x01, &dtcl, 1); // DCTL 0x10 of MTP
+                }
+
+                // Master
+                _sendIndexDataMaster(0x12, data3_970, 3); // RAM_RW
+                _sendIndexDataMaster(0x10, blackBuffer, _frameSize); // First frame
+                _sendIndexDataMaster(0x12, data3_970, 3); // RAM_RW
+                _sendIndexDataMaster(0x11, redBuffer, _frameSize); // Second frame
+
+                // Slave
+                _sendIndexDataSlave(0x12, data3_970, 3); // RAM_RW
+                _sendIndexDataSlave(0x10, blackBuffer + _frameSize, _frameSize); // First frame
+                _sendIndexDataSlave(0x12, data3_970, 3); // RAM_RW
+                _sendIndexDataSlave(0x11, redBuffer + _frameSize, _frameSize); // Second frame
+
+                // Initial COG
+                data[0] = 0x7d;
+                _sendIndexData(0x05, data, 1);
+                _flushWait(200);
+                break;
+
+            case 7:
+
+                data[0] = 0x00;
+                _sendIndexData(0x05, data, 1);
+                _flushWait(10);
+                break;
+
+            case 8:
+
+                data[0] = 0x3f;
+                _sendIndexData(0xc2, data, 1);
+                _flushWait(1);
+                break;
+
+            case 9:
+
+                data[0] = 0x80;
+                _sendIndexData(0xd8, data, 1); // MS_SYNC
+                data[0] = 0x00;
+                _sendIndexData(0xd6, data, 1); // BVSS
+                data[0] = 0x10;
+                _sendIndexData(0xa7, data, 1);
+                _flushWait(100);
+                break;
+
+            case 10:
+
+                data[0] = 0x00;
+                _sendIndexData(0xa7, data, 1);
+                _flushWait(100);
+                break;
+
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+            case 16:
+            case 17:
+            case 18:
+
+                // Master for steps 11 to 14, slave for steps 15 to 18
+                send = (step < 15) ? &Screen_EPD_EXT3::_sendIndexDataMaster : &Screen_EPD_EXT3::_sendIndexDataSlave;
+
+                if (step == 11)
+                {
+                    // --- 9.69 and 11.9 specific
+                    data[0] = 0x00;
+                    data[1] = (_codeSize == 0x96) ? 0x11 : 0x12; // OSC
+                    _sendIndexData(0x03, data, 2); // OSC
+                }
+
+                if ((step == 11) or (step == 15))
+                {
+                    data[0] = 0x00;
+                    (this->*send)(0x44, data, 1);
+                    data[0] = 0x80;
+                    (this->*send)(0x45, data, 1);
+                    data[0] = 0x10;
+                    (this->*send)(0xa7, data, 1);
+                }
+                else if ((step == 13) or (step == 17))
+                {
+                    data[0] = 0x06;
+                    (this->*send)(0x44, data, 1);
+                    data[0] = _temperature * 2 + 0x50; // Temperature 0x82@25C   0°C = 0x50, 25°C = 0x82
+                    (this->*send)(0x45, data, 1);
+                    data[0] = 0x10;
+                    (this->*send)(0xa7, data, 1);
+                }
+                else
+                {
+                    data[0] = 0x00;
+                    (this->*send)(0xa7, data, 1);
+                }
+                _flushWait(100);
+                break;
+
+            case 19:
+
+                data[0] = 0x25;
+                _sendIndexData(0x60, data, 1); // TCON
+                data[0] = 0x01;
+                _sendIndexDataMaster(0x61, data, 1); // STV_DIR for Master
+                data[0] = 0x00;
+                _sendIndexData(0x01, data, 1); // DCTL
+                _sendIndexData(0x02, data, 1); // VCOM
+
+                // DC-DC soft-start
+                data[0] = 0x50;
+                data[1] = 0x01;
+                _sendIndexData(0x51, data, 2);
+                _flushCount = 0;
+                break;
+
+            case 20:
+
+                _flushSoftStart(_flushCount);
+                _flushCount++;
+                if (_flushCount < 30)
+                {
+                    _flushStep = 20;
+                }
+                _flushWait(2);
+                break;
+
+            case 21:
+
+                data[0] = 0xff;
+                _sendIndexData(0x09, data, 1);
+
+                // Display Refresh Start
+                _flushWait(10, true);
+                break;
+
+            case 22:
+
+                data[0] = 0x3c;
+                _sendIndexData(0x15, data, 1); // Display Refresh
+
+                // DC/DC off
+                _flushWait(5, true, FLUSH_PHASE_REFRESH);
+                break;
+
+            case 23:
+
+                data[0] = 0x7f;
+                _sendIndexData(0x09, data, 1);
+                data[0] = 0x7d;
+                _sendIndexData(0x05, data, 1);
+                data[0] = 0x00;
+                _sendIndexData(0x09, data, 1);
+                _flushWait(200, true, FLUSH_PHASE_OFF);
+                break;
+
+            default:
+
+                digitalWrite(_pin.panelDC, LOW);
+                digitalWrite(_pin.panelCS, LOW);
+
+                if (_pin.panelCSS != NOT_CONNECTED)
+                {
+                    digitalWrite(_pin.panelCSS, LOW);
+                }
+
+                digitalWrite(_pin.panelReset, LOW);
+                // digitalWrite(PNLON_PIN, LOW); // PANEL_OFF# = 0
+
+                if (_pin.panelCSS != NOT_CONNECTED)
+                {
+                    digitalWrite(_pin.panelCSS, HIGH); // CSS# = 1
+                }
+                digitalWrite(_pin.panelCS, HIGH); // CS# = 1
+                _flushStep = 0;
+                break;
         }
     }
     else // small, including 420 and 437
     {
-        _reset(5, 5, 10, 5, 5);
+        uint8_t data[1];
 
-        uint8_t data9[] = {0x0e};
-        _sendIndexData(0x00, data9, 1); // Soft-reset
-        delay_ms(5);
+        switch (step)
+        {
+            case 6:
 
-        uint8_t data7[] = {0x19};
-        data7[0] = _temperature; // _temperature
-        _sendIndexData(0xe5, data7, 1); // Input Temperature 0°C = 0x00, 22°C = 0x16, 25°C = 0x19
-        uint8_t data6[] = {0x02};
-        _sendIndexData(0xe0, data6, 1); // Active Temperature
+                data[0] = 0x0e;
+                _sendIndexData(0x00, data, 1); // Soft-reset
+                _flushWait(5);
+                break;
 
-        // Send image data
-        _sendIndexData(0x10, blackBuffer, _frameSize); // First frame
-        _sendIndexData(0x13, redBuffer, _frameSize); // Second frame
+            case 7:
 
-        delay_ms(50);
-        uint8_t data8[] = {0x00};
-        _sendIndexData(0x04, data8, 1); // Power on
-        delay_ms(5);
-        while (digitalRead(_pin.panelBusy) != HIGH)
-        {
-            delay(100);
-        };
+                data[0] = _temperature; // _temperature
+                _sendIndexData(0xe5, data, 1); // Input Temperature 0°C = 0x00, 22°C = 0x16, 25°C = 0x19
+                data[0] = 0x02;
+                _sendIndexData(0xe0, data, 1); // Active Temperature
 
-        while (digitalRead(_pin.panelBusy) != HIGH);
-        _sendIndexData(0x12, data8, 1); // Display Refresh
-        delay_ms(5);
-        while (digitalRead(_pin.panelBusy) != HIGH)
-        {
-            delay(100);
-        };
+                // Send image data
+                _sendIndexData(0x10, blackBuffer, _frameSize); // First frame
+                _sendIndexData(0x13, redBuffer, _frameSize); // Second frame
+                _flushWait(50);
+                break;
 
-        _sendIndexData(0x02, data8, 1); // Turn off DC/DC
-        delay_ms(5);
-        while (digitalRead(_pin.panelBusy) != HIGH)
-        {
-            delay(100);
-        };
-        digitalWrite(_pin.panelDC, LOW);
-        digitalWrite(_pin.panelCS, LOW);
+            case 8:
+
+                data[0] = 0x00;
+                _sendIndexData(0x04, data, 1); // Power on
+                _flushWait(5, true);
+                break;
+
+            case 9:
+
+                data[0] = 0x00;
+                _sendIndexData(0x12, data, 1); // Display Refresh
+                _flushWait(5, true, FLUSH_PHASE_REFRESH);
+                break;
+
+            case 10:
+
+                data[0] = 0x00;
+                _sendIndexData(0x02, data, 1); // Turn off DC/DC
+                _flushWait(5, true, FLUSH_PHASE_OFF);
+                break;
+
+            default:
+
+                digitalWrite(_pin.panelDC, LOW);
+                digitalWrite(_pin.panelCS, LOW);
 
-        digitalWrite(_pin.panelReset, LOW);
-        // digitalWrite(PNLON_PIN, LOW);
+                digitalWrite(_pin.panelReset, LOW);
+                // digitalWrite(PNLON_PIN, LOW);
+                digitalWrite(_pin.panelCS, HIGH); // CS# = 1
+                _flushStep = 0;
+                break;
+        }
     }
-    digitalWrite(_pin.panelCS, HIGH); // CS# = 1
 }
 
 void Screen_EPD_EXT3::clear(uint16_t colour)
@@ -918,11 +1358,103 @@ void Screen_EPD_EXT3::clear(uint16_t colour)
         memset(_newImage, 0xff, _pageColourSize);
         memset(_newImage + _pageColourSize, 0x00, _pageColourSize);
     }
+
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+    _setDirty(0, 0, _screenSizeV - 1, _screenSizeH - 1);
+#endif // DIRTY_MODE
+}
+
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+bool Screen_EPD_EXT3::isDirty()
+{
+    uint16_t size = ((uint32_t)_dirtySizeX * _dirtySizeY + 7) >> 3;
+    for (uint16_t i = 0; i < size; i++)
+    {
+        if (_dirtyMap[i] != 0x00)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+const uint8_t * Screen_EPD_EXT3::getDirtyMap(uint16_t & tilesX, uint16_t & tilesY)
+{
+    tilesX = _dirtySizeX;
+    tilesY = _dirtySizeY;
+    return _dirtyMap;
+}
+
+bool Screen_EPD_EXT3::getDirtyArea(uint16_t & x1, uint16_t & y1, uint16_t & x2, uint16_t & y2)
+{
+    // Bounding tiles
+    uint16_t tileX1 = 0xffff;
+    uint16_t tileY1 = 0xffff;
+    uint16_t tileX2 = 0;
+    uint16_t tileY2 = 0;
+    uint16_t i = 0;
+    for (uint16_t tileX = 0; tileX < _dirtySizeX; tileX++)
+    {
+        for (uint16_t tileY = 0; tileY < _dirtySizeY; tileY++)
+        {
+            if (bitRead(_dirtyMap[i >> 3], i & 0x07))
+            {
+                tileX1 = min(tileX1, tileX);
+                tileY1 = min(tileY1, tileY);
+                tileX2 = max(tileX2, tileX);
+                tileY2 = max(tileY2, tileY);
+            }
+            i++;
+        }
+    }
+
+    if (tileX1 == 0xffff)
+    {
+        return true;
+    }
+
+    // Physical coordinates
+    int32_t px1 = tileX1 << 3;
+    int32_t py1 = tileY1 << 6;
+    int32_t px2 = min((tileX2 << 3) + 7, _screenSizeV - 1);
+    int32_t py2 = min((tileY2 << 6) + 63, _screenSizeH - 1);
+
+    // Back to logical coordinates, the orientation matrix is its own transpose inverse
+    int32_t lx1 = _addressXX * (px1 - _addressBaseX) + _addressXY * (py1 - _addressBaseY);
+    int32_t ly1 = _addressYX * (px1 - _addressBaseX) + _addressYY * (py1 - _addressBaseY);
+    int32_t lx2 = _addressXX * (px2 - _addressBaseX) + _addressXY * (py2 - _addressBaseY);
+    int32_t ly2 = _addressYX * (px2 - _addressBaseX) + _addressYY * (py2 - _addressBaseY);
+
+    x1 = min(lx1, lx2);
+    y1 = min(ly1, ly2);
+    x2 = max(lx1, lx2);
+    y2 = max(ly1, ly2);
+    return false;
+}
+
+void Screen_EPD_EXT3::resetDirty()
+{
+    memset(_dirtyMap, 0x00, ((uint32_t)_dirtySizeX * _dirtySizeY + 7) >> 3);
+}
+
+void Screen_EPD_EXT3::_setDirty(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    for (uint16_t tileX = x1 >> 3; tileX <= (x2 >> 3); tileX++)
+    {
+        uint32_t i = (uint32_t)tileX * _dirtySizeY + (y1 >> 6);
+        for (uint16_t tileY = y1 >> 6; tileY <= (y2 >> 6); tileY++)
+        {
+            bitSet(_dirtyMap[i >> 3], i & 0x07);
+            i++;
+        }
+    }
 }
+#endif // DIRTY_MODE
 
 void Screen_EPD_EXT3::invert(bool flag)
 {
     _invert = flag;
+    _inkValid = false;
 }
 
 void Screen_EPD_EXT3::_setPoint(uint16_t x1, uint16_t y1, uint16_t colour)
@@ -935,10 +1467,55 @@ void Screen_EPD_EXT3::_setPoint(uint16_t x1, uint16_t y1, uint16_t colour)
     }
 
     uint32_t z1 = _getZ(x1, y1);
+    const ink_s & ink = _getInk(colour);
 
-    // Convert combined colours into basic colours
-    bool flagOdd = ((x1 + y1) % 2 == 0);
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+    uint32_t i = (uint32_t)(x1 >> 3) * _dirtySizeY + (y1 >> 6);
+    _dirtyMap[i >> 3] |= (ink.mask & (1 << (i & 0x07)));
+#endif // DIRTY_MODE
+
+    // Bit 7 - (y1 % 8), no bit if colour not drawn
+    uint8_t mask = (0x80 >> (y1 & 0x07)) & ink.mask;
+    uint8_t * black = _newImage + z1;
+    uint8_t * red = black + _pageColourSize;
+
+    *black = (*black & ~mask) | (ink.black[x1 & 0x01] & mask);
+    *red = (*red & ~mask) | (ink.red[x1 & 0x01] & mask);
+}
+
+const ink_s & Screen_EPD_EXT3::_getInk(uint16_t colour)
+{
+    if ((_inkValid) and (colour == _inkColour))
+    {
+        return _ink;
+    }
+
+    // Colours are either drawn on all pixels or on none
+    // flagOdd pixels are on bits 7-5-3-1 for even rows, 6-4-2-0 for odd rows
+    uint8_t valueOdd = _getBasicColour(colour, true);
+    uint8_t valueEven = _getBasicColour(colour, false);
+
+    if ((valueOdd == 0xff) or (valueEven == 0xff))
+    {
+        _ink = {{0x00, 0x00}, {0x00, 0x00}, 0x00};
+    }
+    else
+    {
+        _ink.black[0] = ((valueOdd & 0x10) ? 0b10101010 : 0) | ((valueEven & 0x10) ? 0b01010101 : 0);
+        _ink.black[1] = ((valueOdd & 0x10) ? 0b01010101 : 0) | ((valueEven & 0x10) ? 0b10101010 : 0);
+        _ink.red[0] = ((valueOdd & 0x01) ? 0b10101010 : 0) | ((valueEven & 0x01) ? 0b01010101 : 0);
+        _ink.red[1] = ((valueOdd & 0x01) ? 0b01010101 : 0) | ((valueEven & 0x01) ? 0b10101010 : 0);
+        _ink.mask = 0xff;
+    }
 
+    _inkColour = colour;
+    _inkValid = true;
+    return _ink;
+}
+
+uint8_t Screen_EPD_EXT3::_getBasicColour(uint16_t colour, bool flagOdd)
+{
+    // Convert combined colours into basic colours
     if (colour == myColours.darkRed)
     {
         if (flagOdd)
@@ -974,76 +1551,304 @@ void Screen_EPD_EXT3::_setPoint(uint16_t x1, uint16_t y1, uint16_t colour)
     }
 
     // Basic colours
+    // red = 0-1, black = 1-0, white 0-0
+    uint8_t value = 0xff; // not drawn
     if (colour == myColours.red)
     {
-        // physical red 01
-        bitClear(_newImage[z1], 7 - (y1 % 8));
-        bitSet(_newImage[_pageColourSize + z1], 7 - (y1 % 8));
+        value = 0x01;
     }
     else if ((colour == myColours.white) xor _invert)
     {
-        // physical black 00
-        bitClear(_newImage[z1], 7 - (y1 % 8));
-        bitClear(_newImage[_pageColourSize + z1], 7 - (y1 % 8));
+        value = 0x00;
     }
     else if ((colour == myColours.black) xor _invert)
     {
-        // physical white 10
-        bitSet(_newImage[z1], 7 - (y1 % 8));
-        bitClear(_newImage[_pageColourSize + z1], 7 - (y1 % 8));
+        value = 0x10;
     }
+
+    return value;
 }
 
-void Screen_EPD_EXT3::_setOrientation(uint8_t orientation)
+void Screen_EPD_EXT3::_setSpanX(uint16_t x1, uint16_t x2, uint16_t y1, uint16_t colour)
 {
-    _orientation = orientation % 4;
+    // Already clipped, orient both ends, the span remains a span
+    uint16_t y2 = y1;
+    _orientCoordinates(x1, y1);
+    _orientCoordinates(x2, y2);
+    _setArea(x1, y1, x2, y2, colour);
 }
 
-bool Screen_EPD_EXT3::_orientCoordinates(uint16_t & x, uint16_t & y)
+void Screen_EPD_EXT3::_setSpanY(uint16_t x1, uint16_t y1, uint16_t y2, uint16_t colour)
 {
-    bool flag = true; // false = success, true = error
-    switch (_orientation)
+    // Already clipped, orient both ends, the span remains a span
+    uint16_t x2 = x1;
+    _orientCoordinates(x1, y1);
+    _orientCoordinates(x2, y2);
+    _setArea(x1, y1, x2, y2, colour);
+}
+
+void Screen_EPD_EXT3::_setRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    // Already clipped, orient both corners, the rectangle remains a rectangle
+    _orientCoordinates(x1, y1);
+    _orientCoordinates(x2, y2);
+    _setArea(x1, y1, x2, y2, colour);
+}
+
+void Screen_EPD_EXT3::_setArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    if (x1 > x2)
     {
-        case 3: // checked, previously 1
+        swap(x1, x2);
+    }
+    if (y1 > y2)
+    {
+        swap(y1, y2);
+    }
+
+    const ink_s & ink = _getInk(colour);
+    if (ink.mask == 0x00)
+    {
+        return;
+    }
+
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+    _setDirty(x1, y1, x2, y2);
+#endif // DIRTY_MODE
+
+    // Large screens combine two half-screens, each row split across both halves
+    if (y1 < _addressSplit)
+    {
+        _setRows(0, _addressStride, x1, x2, y1, min(y2, (uint16_t)(_addressSplit - 1)), ink);
+    }
+    if (y2 >= _addressSplit)
+    {
+        _setRows(_pageColourSize >> 1, _addressStride, x1, x2, max(y1, _addressSplit) - _addressSplit, y2 - _addressSplit, ink);
+    }
+}
+
+void Screen_EPD_EXT3::_setRows(uint32_t offset, uint16_t stride, uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2, const ink_s & ink)
+{
+    // Bit 7 - (y1 % 8) of byte y1 / 8
+    uint16_t byte1 = y1 >> 3;
+    uint16_t byte2 = y2 >> 3;
+    uint8_t mask1 = 0xff >> (y1 & 0x07);
+    uint8_t mask2 = 0xff << (7 - (y2 & 0x07));
+    if (byte1 == byte2)
+    {
+        mask1 &= mask2;
+    }
+
+    uint8_t * blackRow = _newImage + offset + (uint32_t)x1 * stride;
+    for (uint16_t x = x1; x <= x2; x++)
+    {
+        uint8_t * redRow = blackRow + _pageColourSize;
+        uint8_t valueBlack = ink.black[x & 0x01];
+        uint8_t valueRed = ink.red[x & 0x01];
+
+        blackRow[byte1] = (blackRow[byte1] & ~mask1) | (valueBlack & mask1);
+        redRow[byte1] = (redRow[byte1] & ~mask1) | (valueRed & mask1);
 
-            if ((x < _screenSizeV) and (y < _screenSizeH))
+        if (byte2 > byte1)
+        {
+            if (byte2 > byte1 + 1)
             {
-                x = _screenSizeV - 1 - x;
-                flag = false;
+                memset(blackRow + byte1 + 1, valueBlack, byte2 - byte1 - 1);
+                memset(redRow + byte1 + 1, valueRed, byte2 - byte1 - 1);
             }
-            break;
 
-        case 2: // checked
+            blackRow[byte2] = (blackRow[byte2] & ~mask2) | (valueBlack & mask2);
+            redRow[byte2] = (redRow[byte2] & ~mask2) | (valueRed & mask2);
+        }
 
-            if ((x < _screenSizeH) and (y < _screenSizeV))
+        blackRow += stride;
+    }
+}
+
+void Screen_EPD_EXT3::_setBitmap(int16_t x0, int16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, const bitmap_s & bitmap)
+{
+    // Inks for set or black pixels, red pixels, clear or white pixels
+    ink_s inks[3];
+    inks[0] = _getInk(bitmap.frontColour);
+    inks[1] = _getInk(myColours.red);
+    inks[2] = _getInk(bitmap.backColour);
+
+    // Physical area
+    _orientCoordinates(x1, y1);
+    _orientCoordinates(x2, y2);
+    if (x1 > x2)
+    {
+        swap(x1, x2);
+    }
+    if (y1 > y2)
+    {
+        swap(y1, y2);
+    }
+
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+    _setDirty(x1, y1, x2, y2);
+#endif // DIRTY_MODE
+
+    // Steps in bitmap for next physical row and for next physical bit
+    int8_t rowX = _addressXX;
+    int8_t rowY = _addressYX;
+    int8_t bitX = _addressXY;
+    int8_t bitY = _addressYY;
+
+    uint8_t blockData[8];
+    uint8_t blockRed[8];
+    uint8_t blockMask[8];
+
+    // Blocks of 8 rows by 8 bits, starting on y1
+    for (uint16_t y = y1; y <= y2; y += 8)
+    {
+        uint8_t bits = min(y2 - y + 1, 8);
+        uint8_t valid = 0xff << (8 - bits);
+        uint8_t shift = y & 0x07;
+
+        for (uint16_t x = x1; x <= x2; x += 8)
+        {
+            uint8_t rows = min(x2 - x + 1, 8);
+
+            // Bitmap coordinates of physical (x, y)
+            int16_t bx = _addressXX * (x - _addressBaseX) + _addressXY * (y - _addressBaseY) - x0;
+            int16_t by = _addressYX * (x - _addressBaseX) + _addressYY * (y - _addressBaseY) - y0;
+
+            _getBitmapBlock(bitmap.data, bitmap, bx, by, rowX, rowY, bitX, bitY, rows, bits, blockData);
+            if (bitmap.red != 0)
+            {
+                _getBitmapBlock(bitmap.red, bitmap, bx, by, rowX, rowY, bitX, bitY, rows, bits, blockRed);
+            }
+            else
             {
-                x = _screenSizeH - 1 - x;
-                y = _screenSizeV - 1 - y;
-                swap(x, y);
-                flag = false;
+                memset(blockRed, 0x00, 8);
             }
+            if (bitmap.mode == BITMAP_MASKED)
+            {
+                _getBitmapBlock(bitmap.mask, bitmap, bx, by, rowX, rowY, bitX, bitY, rows, bits, blockMask);
+            }
+
+            for (uint8_t i = 0; i < rows; i++)
+            {
+                uint8_t bits0 = blockData[i]; // set or black
+                uint8_t bits1 = blockRed[i] & ~bits0; // red
+                uint8_t bits2 = ~(bits0 | blockRed[i]); // clear or white
+
+                uint8_t mask = valid;
+                if (bitmap.mode == BITMAP_TRANSPARENT)
+                {
+                    mask &= ~bits2;
+                }
+                else if (bitmap.mode == BITMAP_MASKED)
+                {
+                    mask &= blockMask[i];
+                }
+
+                // Up to two bytes, aligned on frame-buffer
+                uint8_t parity = (x + i) & 0x01;
+                _setInkByte(_getZ(x + i, y), parity, mask >> shift, bits0 >> shift, bits1 >> shift, bits2 >> shift, inks);
+                if (shift + bits > 8)
+                {
+                    _setInkByte(_getZ(x + i, y + 8 - shift), parity, mask << (8 - shift), bits0 << (8 - shift), bits1 << (8 - shift), bits2 << (8 - shift), inks);
+                }
+            }
+        }
+    }
+}
+
+void Screen_EPD_EXT3::_setInkByte(uint32_t z1, uint8_t parity, uint8_t mask, uint8_t bits0, uint8_t bits1, uint8_t bits2, const ink_s * inks)
+{
+    // Inks not drawn are masked out
+    mask &= (bits0 & inks[0].mask) | (bits1 & inks[1].mask) | (bits2 & inks[2].mask);
+    uint8_t valueBlack = (bits0 & inks[0].black[parity]) | (bits1 & inks[1].black[parity]) | (bits2 & inks[2].black[parity]);
+    uint8_t valueRed = (bits0 & inks[0].red[parity]) | (bits1 & inks[1].red[parity]) | (bits2 & inks[2].red[parity]);
+
+    _newImage[z1] = (_newImage[z1] & ~mask) | (valueBlack & mask);
+    _newImage[_pageColourSize + z1] = (_newImage[_pageColourSize + z1] & ~mask) | (valueRed & mask);
+}
+
+uint8_t Screen_EPD_EXT3::_getNativeFormat()
+{
+    // Bytes run along physical y, logical x or logical y
+    return (_addressXY != 0) ? BITMAP_ROW : BITMAP_COLUMN;
+}
+
+void Screen_EPD_EXT3::_setOrientation(uint8_t orientation)
+{
+    _orientation = orientation % 4;
+
+    // Addressing, per orientation
+    // Physical coordinates = base + logical x * step x + logical y * step y
+    switch (_orientation)
+    {
+        case 3: // checked, previously 1
+
+            _addressSizeX = _screenSizeV;
+            _addressSizeY = _screenSizeH;
+            _addressBaseX = _screenSizeV - 1;
+            _addressBaseY = 0;
+            _addressXX = -1;
+            _addressXY = 0;
+            _addressYX = 0;
+            _addressYY = 1;
+            break;
+
+        case 2: // checked
+
+            _addressSizeX = _screenSizeH;
+            _addressSizeY = _screenSizeV;
+            _addressBaseX = _screenSizeV - 1;
+            _addressBaseY = _screenSizeH - 1;
+            _addressXX = 0;
+            _addressXY = -1;
+            _addressYX = -1;
+            _addressYY = 0;
             break;
 
         case 1: // checked, previously 3
 
-            if ((x < _screenSizeV) and (y < _screenSizeH))
-            {
-                y = _screenSizeH - 1 - y;
-                flag = false;
-            }
+            _addressSizeX = _screenSizeV;
+            _addressSizeY = _screenSizeH;
+            _addressBaseX = 0;
+            _addressBaseY = _screenSizeH - 1;
+            _addressXX = 1;
+            _addressXY = 0;
+            _addressYX = 0;
+            _addressYY = -1;
             break;
 
         default: // checked
 
-            if ((x < _screenSizeH) and (y < _screenSizeV))
-            {
-                swap(x, y);
-                flag = false;
-            }
+            _addressSizeX = _screenSizeH;
+            _addressSizeY = _screenSizeV;
+            _addressBaseX = 0;
+            _addressBaseY = 0;
+            _addressXX = 0;
+            _addressXY = 1;
+            _addressYX = 1;
+            _addressYY = 0;
             break;
     }
 
-    return flag;
+    // Per pixel, swap and sign flip instead of steps
+    _addressSwap = (_addressXX == 0);
+    _addressFlipX = (_addressXX + _addressYX < 0);
+    _addressFlipY = (_addressXY + _addressYY < 0);
+}
+
+bool Screen_EPD_EXT3::_orientCoordinates(uint16_t & x, uint16_t & y)
+{
+    // false = success, true = error
+    if ((x >= _addressSizeX) or (y >= _addressSizeY))
+    {
+        return true;
+    }
+
+    uint16_t x1 = _addressSwap ? y : x;
+    uint16_t y1 = _addressSwap ? x : y;
+    x = _addressFlipX ? _addressBaseX - x1 : x1;
+    y = _addressFlipY ? _addressBaseY - y1 : y1;
+    return false;
 }
 
 uint32_t Screen_EPD_EXT3::_getZ(uint16_t x1, uint16_t y1)
@@ -1051,19 +1856,12 @@ uint32_t Screen_EPD_EXT3::_getZ(uint16_t x1, uint16_t y1)
     uint32_t z1 = 0;
     // According to 11.98 inch Spectra Application Note
     // at http:// www.pervasivedisplays.com/LiteratureRetrieve.aspx?ID=245146
-    if ((_codeSize == 0x96) or (_codeSize == 0xB9))
-    {
-        if (y1 >= (_screenSizeH >> 1))
-        {
-            y1 -= (_screenSizeH >> 1); // rebase y1
-            z1 += (_pageColourSize >> 1); // buffer second half
-        }
-        z1 += (uint32_t)x1 * (_bufferSizeH >> 1) + (y1 >> 3);
-    }
-    else
+    if (y1 >= _addressSplit)
     {
-        z1 = (uint32_t)x1 * _bufferSizeH + (y1 >> 3);
+        y1 -= _addressSplit; // rebase y1
+        z1 = (_pageColourSize >> 1); // buffer second half
     }
+    z1 += (uint32_t)x1 * _addressStride + (y1 >> 3);
     return z1;
 }
 
@@ -1109,24 +1907,148 @@ uint16_t Screen_EPD_EXT3::_getPoint(uint16_t x1, uint16_t y1)
 
 void Screen_EPD_EXT3::point(uint16_t x1, uint16_t y1, uint16_t colour)
 {
+    if (_clipCoordinates(x1, y1))
+    {
+        return;
+    }
     _setPoint(x1, y1, colour);
 }
 
 uint16_t Screen_EPD_EXT3::readPixel(uint16_t x1, uint16_t y1)
 {
-    return _getPoint(x1, y1);
+    // Relative to viewport origin
+    return _getPoint(x1 + _originX, y1 + _originY);
 }
 
 // Utilities
+void Screen_EPD_EXT3::_sendData(const uint8_t * data, uint32_t size)
+{
+#if (SPI_TRANSFER_MODE == USE_SPI_BULK) and !defined(ENERGIA)
+
+#if defined(ARDUINO_ARCH_ESP32) or defined(ARDUINO_ARCH_ESP8266)
+
+    // Write-only bulk transfer
+    SPI.writeBytes(data, size);
+
+#elif defined(ARDUINO_ARCH_RP2040) and !defined(ARDUINO_ARCH_MBED)
+
+    // Write-only bulk transfer, received bytes discarded
+    SPI.transfer(data, 0, size);
+
+#else
+
+    // Chunks copied, as SPI.transfer() replaces the sent bytes with the received ones
+    uint8_t buffer[SPI_CHUNK_SIZE];
+    while (size > 0)
+    {
+        uint16_t number = (size < sizeof(buffer)) ? size : sizeof(buffer);
+        memcpy(buffer, data, number);
+        SPI.transfer(buffer, number);
+        data += number;
+        size -= number;
+    }
+
+#endif // ARDUINO_ARCH
+
+#else
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        SPI.transfer(data[i]);
+    }
+
+#endif // SPI_TRANSFER_MODE
+}
+
+void Screen_EPD_EXT3::_fastPinBegin(fastPin_s & fast, uint8_t pin)
+{
+    fast.set = 0;
+    fast.clear = 0;
+    fast.mask = 0; // digitalWrite()
+    fast.pin = pin;
+
+    if (pin == NOT_CONNECTED)
+    {
+        return;
+    }
+
+#if (FAST_PIN_MODE == USE_FAST_PIN_REGISTER) and !defined(ENERGIA)
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+    if (pin < 32)
+    {
+        fast.set = (volatile uint32_t *)GPIO_OUT_W1TS_REG;
+        fast.clear = (volatile uint32_t *)GPIO_OUT_W1TC_REG;
+        fast.mask = 1UL << pin;
+    }
+#if defined(GPIO_OUT1_W1TS_REG)
+    else
+    {
+        fast.set = (volatile uint32_t *)GPIO_OUT1_W1TS_REG;
+        fast.clear = (volatile uint32_t *)GPIO_OUT1_W1TC_REG;
+        fast.mask = 1UL << (pin - 32);
+    }
+#endif // GPIO_OUT1_W1TS_REG
+
+#elif defined(ARDUINO_ARCH_ESP8266)
+
+    // GPIO16 on RTC register, with digitalWrite()
+    if (pin < 16)
+    {
+        fast.set = &GPOS;
+        fast.clear = &GPOC;
+        fast.mask = 1UL << pin;
+    }
+
+#elif defined(ARDUINO_ARCH_RP2040) and !defined(ARDUINO_ARCH_MBED)
+
+    fast.set = &sio_hw->gpio_set;
+    fast.clear = &sio_hw->gpio_clr;
+    fast.mask = 1UL << pin;
+
+#elif defined(ARDUINO_ARCH_SAMD)
+
+    fast.set = &(digitalPinToPort(pin)->OUTSET.reg);
+    fast.clear = &(digitalPinToPort(pin)->OUTCLR.reg);
+    fast.mask = digitalPinToBitMask(pin);
+
+#elif defined(ARDUINO_NRF52_ADAFRUIT)
+
+    fast.set = &(digitalPinToPort(pin)->OUTSET);
+    fast.clear = &(digitalPinToPort(pin)->OUTCLR);
+    fast.mask = digitalPinToBitMask(pin);
+
+#endif // ARDUINO_ARCH
+
+#endif // FAST_PIN_MODE
+}
+
+void Screen_EPD_EXT3::_fastWrite(const fastPin_s & fast, uint8_t value)
+{
+    if (fast.mask == 0)
+    {
+        digitalWrite(fast.pin, value);
+    }
+    else if (value == LOW)
+    {
+        *fast.clear = fast.mask;
+    }
+    else
+    {
+        *fast.set = fast.mask;
+    }
+}
+
 void Screen_EPD_EXT3::_sendIndexData(uint8_t index, const uint8_t * data, uint32_t size)
 {
-    digitalWrite(_pin.panelDC, LOW); // DC Low
-    digitalWrite(_pin.panelCS, LOW); // CS Low
+    _fastWrite(_fastDC, LOW); // DC Low
+    _fastWrite(_fastCS, LOW); // CS Low
     if ((_codeSize == 0x96) or (_codeSize == 0xB9))
     {
         if (_pin.panelCSS != NOT_CONNECTED)
         {
-            digitalWrite(_pin.panelCSS, LOW);
+            _fastWrite(_fastCSS, LOW);
         }
         delayMicroseconds(450); // 450 + 50 = 500
     }
@@ -1138,35 +2060,32 @@ void Screen_EPD_EXT3::_sendIndexData(uint8_t index, const uint8_t * data, uint32
         if (_pin.panelCSS != NOT_CONNECTED)
         {
             delayMicroseconds(450);    // 450 + 50 = 500
-            digitalWrite(_pin.panelCSS, HIGH);
+            _fastWrite(_fastCSS, HIGH);
         }
     }
-    digitalWrite(_pin.panelCS, HIGH); // CS High
-    digitalWrite(_pin.panelDC, HIGH); // DC High
-    digitalWrite(_pin.panelCS, LOW); // CS Low
+    _fastWrite(_fastCS, HIGH); // CS High
+    _fastWrite(_fastDC, HIGH); // DC High
+    _fastWrite(_fastCS, LOW); // CS Low
     if ((_codeSize == 0x96) or (_codeSize == 0xB9))
     {
         if (_pin.panelCSS != NOT_CONNECTED)
         {
-            digitalWrite(_pin.panelCSS, LOW); // CSS Low
+            _fastWrite(_fastCSS, LOW); // CSS Low
             delayMicroseconds(450); // 450 + 50 = 500
         }
     }
     delayMicroseconds(50);
-    for (uint32_t i = 0; i < size; i++)
-    {
-        SPI.transfer(data[i]);
-    }
+    _sendData(data, size);
     delayMicroseconds(50);
     if ((_codeSize == 0x96) or (_codeSize == 0xB9))
     {
         if (_pin.panelCSS != NOT_CONNECTED)
         {
             delayMicroseconds(450); // 450 + 50 = 500
-            digitalWrite(_pin.panelCSS, HIGH);
+            _fastWrite(_fastCSS, HIGH);
         }
     }
-    digitalWrite(_pin.panelCS, HIGH); // CS High
+    _fastWrite(_fastCS, HIGH); // CS High
 }
 
 void Screen_EPD_EXT3::regenerate()
@@ -1185,34 +2104,31 @@ void Screen_EPD_EXT3::_sendIndexDataMaster(uint8_t index, const uint8_t * data,
 {
     if (_pin.panelCSS != NOT_CONNECTED)
     {
-        digitalWrite(_pin.panelCSS, HIGH); // CS slave HIGH
+        _fastWrite(_fastCSS, HIGH); // CS slave HIGH
     }
-    digitalWrite(_pin.panelDC, LOW); // DC Low = Command
-    digitalWrite(_pin.panelCS, LOW); // CS Low = Select
+    _fastWrite(_fastDC, LOW); // DC Low = Command
+    _fastWrite(_fastCS, LOW); // CS Low = Select
     delayMicroseconds(500);
     SPI.transfer(index);
     delayMicroseconds(500);
-    digitalWrite(_pin.panelCS, HIGH); // CS High = Unselect
-    digitalWrite(_pin.panelDC, HIGH); // DC High = Data
-    digitalWrite(_pin.panelCS, LOW); // CS Low = Select
+    _fastWrite(_fastCS, HIGH); // CS High = Unselect
+    _fastWrite(_fastDC, HIGH); // DC High = Data
+    _fastWrite(_fastCS, LOW); // CS Low = Select
     delayMicroseconds(500);
 
-    for (uint32_t i = 0; i < size; i++)
-    {
-        SPI.transfer(data[i]);
-    }
+    _sendData(data, size);
     delayMicroseconds(500);
-    digitalWrite(_pin.panelCS, HIGH); // CS High= Unselect
+    _fastWrite(_fastCS, HIGH); // CS High= Unselect
 }
 
 // Software SPI Slave protocol setup
 void Screen_EPD_EXT3::_sendIndexDataSlave(uint8_t index, const uint8_t * data, uint32_t size)
 {
-    digitalWrite(_pin.panelCS, HIGH); // CS Master High
-    digitalWrite(_pin.panelDC, LOW); // DC Low= Command
+    _fastWrite(_fastCS, HIGH); // CS Master High
+    _fastWrite(_fastDC, LOW); // DC Low= Command
     if (_pin.panelCSS != NOT_CONNECTED)
     {
-        digitalWrite(_pin.panelCSS, LOW); // CS slave LOW
+        _fastWrite(_fastCSS, LOW); // CS slave LOW
     }
 
     delayMicroseconds(500);
@@ -1221,26 +2137,23 @@ void Screen_EPD_EXT3::_sendIndexDataSlave(uint8_t index, const uint8_t * data, u
 
     if (_pin.panelCSS != NOT_CONNECTED)
     {
-        digitalWrite(_pin.panelCSS, HIGH); // CS slave HIGH
+        _fastWrite(_fastCSS, HIGH); // CS slave HIGH
     }
 
-    digitalWrite(_pin.panelDC, HIGH); // DC High = Data
+    _fastWrite(_fastDC, HIGH); // DC High = Data
 
     if (_pin.panelCSS != NOT_CONNECTED)
     {
-        digitalWrite(_pin.panelCSS, LOW); // CS slave LOW
+        _fastWrite(_fastCSS, LOW); // CS slave LOW
     }
 
     delayMicroseconds(500);
 
-    for (uint32_t i = 0; i < size; i++)
-    {
-        SPI.transfer(data[i]);
-    }
+    _sendData(data, size);
     delayMicroseconds(500);
     if (_pin.panelCSS != NOT_CONNECTED)
     {
-        digitalWrite(_pin.panelCSS, HIGH); // CS slave HIGH
+        _fastWrite(_fastCSS, HIGH); // CS slave HIGH
     }
 }
 
@@ -1342,6 +2255,13 @@ uint8_t Screen_EPD_EXT3::flushMode(uint8_t updateMode)
         case UPDATE_GLOBAL:
 
             _flushGlobal();
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+            // Frame-buffer not displayed on timeout
+            if (_flushResult == RESULT_SUCCESS)
+            {
+                resetDirty();
+            }
+#endif // DIRTY_MODE
             break;
 
         default:
@@ -1356,3 +2276,7 @@ uint8_t Screen_EPD_EXT3::flushMode(uint8_t updateMode)
 // === End of Temperature section
 //
 
+#if (USE_hV_SCREEN == USE_hV_SCREEN_STATIC)
+// Instantiated here, where _setPoint() is defined and can be inlined
+template class hV_Screen_Static<Screen_EPD_EXT3>;
+#endif // USE_hV_SCREEN
@@ -57,8 +57,47 @@
 #error Required hV_SCREEN_BUFFER_RELEASE 523
 #endif // hV_SCREEN_BUFFER_RELEASE
 
+#if (USE_hV_SCREEN == USE_hV_SCREEN_STATIC)
+#include "hV_Screen_Static.h"
+#endif // USE_hV_SCREEN
+
+///
+/// @name Phases of update
+/// @brief Busy waits learnt for prediction
+/// @{
+#define FLUSH_PHASE_NONE 0 ///< Not learnt
+#define FLUSH_PHASE_REFRESH 1 ///< Display Refresh
+#define FLUSH_PHASE_OFF 2 ///< DC-DC off
+/// @}
+
 // Objects
 //
+///
+/// @brief Structure for ink
+/// @details Colour resolved into frame-buffer patterns,
+/// including the checkerboard of grey, dark red and light red
+/// @note Patterns are for even and odd physical rows
+///
+struct ink_s
+{
+    uint8_t black[2]; ///< black page patterns
+    uint8_t red[2]; ///< red page patterns
+    uint8_t mask; ///< 0xff = drawn, 0x00 = not drawn
+};
+
+///
+/// @brief Structure for fast pin
+/// @details Set and clear registers resolved from the pin number
+/// @note mask = 0 for digitalWrite()
+///
+struct fastPin_s
+{
+    volatile uint32_t * set; ///< register to set pin HIGH
+    volatile uint32_t * clear; ///< register to set pin LOW
+    uint32_t mask; ///< bit of pin, 0 = digitalWrite()
+    uint8_t pin; ///< pin number
+};
+
 ///
 /// @brief Class for Pervasive Displays iTC monochome and colour screens
 /// @details Screen controllers
@@ -69,8 +108,16 @@
 /// @note All commands work on the frame-buffer,
 /// to be displayed on screen with flush()
 ///
+#if (USE_hV_SCREEN == USE_hV_SCREEN_STATIC)
+class Screen_EPD_EXT3 final : public hV_Screen_Static<Screen_EPD_EXT3>
+#else
 class Screen_EPD_EXT3 final : public hV_Screen_Buffer
+#endif // USE_hV_SCREEN
 {
+#if (USE_hV_SCREEN == USE_hV_SCREEN_STATIC)
+    friend class hV_Screen_Static<Screen_EPD_EXT3>;
+#endif // USE_hV_SCREEN
+
   public:
     ///
     /// @brief Constructor with default pins
@@ -153,11 +200,108 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer
     ///
     uint8_t flushMode(uint8_t updateMode = UPDATE_GLOBAL);
 
+    /// @name Non-blocking update
+    /// @note Same sequence as flush(), with the waits left to poll()
+    /// @warning The frame-buffer shouldn't be modified until isBusy() returns false
+    /// @{
+
+    ///
+    /// @brief Start global update, non-blocking
+    /// @return RESULT_SUCCESS = started, RESULT_ERROR = update in progress or UPDATE_NONE
+    /// @note Mode checked with checkTemperatureMode()
+    ///
+    uint8_t flushAsync();
+
+    ///
+    /// @brief Run the update until next wait
+    /// @return true if update in progress, false if completed
+    /// @note To be called regularly from loop() until false
+    ///
+    bool poll();
+
+    ///
+    /// @brief Check whether an update is in progress
+    /// @return true if in progress
+    ///
+    bool isBusy();
+
+    ///
+    /// @brief Set function called on completion of update
+    /// @param callback function, 0 = none
+    /// @note Called by poll()
+    ///
+    void onComplete(void (*callback)());
+    /// @}
+
+    ///
+    /// @brief Set wait for BUSY
+    /// @param hook function called while the panel is busy, eg. yield(), RTOS delay or notification wait, sleep
+    /// @n 0 = delay(BUSY_POLL_PERIOD)
+    /// @param timeout maximum wait, ms, default = BUSY_TIMEOUT
+    /// @note On timeout, the update is stopped and the panel turned off
+    ///
+    void setBusyWait(void (*hook)(), uint32_t timeout = BUSY_TIMEOUT);
+
+    ///
+    /// @brief Result of last update
+    /// @return RESULT_SUCCESS, or RESULT_ERROR if the panel stayed busy longer than the timeout
+    ///
+    uint8_t getUpdateResult();
+
+    ///
+    /// @brief Predicted time to completion of update
+    /// @return ms, 0 = unknown, 1 minimum otherwise, including when the update overruns the prediction
+    /// @note During update, remaining time of Display Refresh and DC-DC off.
+    /// @n Otherwise, predicted duration of both for the current temperature.
+    /// @n Data transfer not included
+    ///
+    uint32_t getFlushETA();
+
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+    /// @name Dirty map
+    /// @note Tiles of 8 bytes by 8 rows of the frame-buffer, physical coordinates
+    /// @n A tile is dirty when a drawing function has written into it since last flush()
+    /// @{
+
+    ///
+    /// @brief Check whether the frame-buffer has changed since last flush()
+    /// @return true if at least one tile is dirty
+    ///
+    bool isDirty();
+
+    ///
+    /// @brief Get the dirty map
+    /// @param[out] tilesX number of tiles, physical x-axis, 8 rows each
+    /// @param[out] tilesY number of tiles, physical y-axis, 8 bytes = 64 pixels each
+    /// @return pointer to the bitmap, bit (i % 8) of byte (i / 8) for tile i = tileX * tilesY + tileY
+    ///
+    const uint8_t * getDirtyMap(uint16_t & tilesX, uint16_t & tilesY);
+
+    ///
+    /// @brief Get the rectangle containing all dirty tiles
+    /// @param[out] x1 top left coordinate, x-axis
+    /// @param[out] y1 top left coordinate, y-axis
+    /// @param[out] x2 bottom right coordinate, x-axis
+    /// @param[out] y2 bottom right coordinate, y-axis
+    /// @return false = success, true = no dirty tile
+    /// @note Screen coordinates for the current orientation, regardless of viewport
+    ///
+    bool getDirtyArea(uint16_t & x1, uint16_t & y1, uint16_t & x2, uint16_t & y2);
+
+    ///
+    /// @brief Reset the dirty map
+    /// @note Called by flush()
+    ///
+    void resetDirty();
+    /// @}
+#endif // DIRTY_MODE
+
     ///
     /// @brief Draw pixel
     /// @param x1 point coordinate, x-axis
     /// @param y1 point coordinate, y-axis
     /// @param colour 16-bit colour
+    /// @note Coordinates are relative to the viewport origin, and clipped
     ///
     /// @n @b More: @ref Coordinate, @ref Colour
     ///
@@ -168,6 +312,7 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer
     /// @param x1 point coordinate, x-axis
     /// @param y1 point coordinate, y-axis
     /// @return 16-bit colour, bits 15-11 red, bits 10-5 green, bits 4-0 blue
+    /// @note Coordinates are relative to the viewport origin
     ///
     /// @n @b More: @ref Coordinate, @ref Colour
     ///
@@ -214,6 +359,14 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer
     ///
     void _sendIndexDataSlave(uint8_t index, const uint8_t * data, uint32_t size);
 
+    ///
+    /// @brief Send data through SPI, after register
+    /// @param data data
+    /// @param size number of bytes
+    /// @note Bulk transfers with SPI_TRANSFER_MODE = USE_SPI_BULK, byte by byte otherwise
+    ///
+    void _sendData(const uint8_t * data, uint32_t size);
+
     // Orientation
     ///
     /// @brief Set orientation
@@ -248,6 +401,121 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer
     ///
     uint16_t _getPoint(uint16_t x1, uint16_t y1);
 
+    // Spans
+    ///
+    /// @brief Set horizontal span
+    /// @param x1 first point coordinate, x-axis
+    /// @param x2 last point coordinate, x-axis
+    /// @param y1 point coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    void _setSpanX(uint16_t x1, uint16_t x2, uint16_t y1, uint16_t colour);
+
+    ///
+    /// @brief Set vertical span
+    /// @param x1 point coordinate, x-axis
+    /// @param y1 first point coordinate, y-axis
+    /// @param y2 last point coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    void _setSpanY(uint16_t x1, uint16_t y1, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Set filled rectangle
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    void _setRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Fill area, physical coordinates
+    /// @param x1 first corner coordinate, physical x-axis
+    /// @param y1 first corner coordinate, physical y-axis
+    /// @param x2 opposite corner coordinate, physical x-axis
+    /// @param y2 opposite corner coordinate, physical y-axis
+    /// @param colour 16-bit colour
+    /// @note Coordinates already oriented and checked
+    ///
+    void _setArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Fill rows of one frame-buffer half
+    /// @param offset offset of the half for _newImage[]
+    /// @param stride number of bytes per row
+    /// @param x1 first row, physical x-axis
+    /// @param x2 last row, physical x-axis
+    /// @param y1 first bit, physical y-axis, rebased to the half
+    /// @param y2 last bit, physical y-axis, rebased to the half
+    /// @param ink colour resolved by _getInk()
+    ///
+    void _setRows(uint32_t offset, uint16_t stride, uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2, const ink_s & ink);
+
+    // Bitmaps
+    ///
+    /// @brief Set bitmap
+    /// @param x0 top left coordinate of the bitmap, x-axis, may be negative
+    /// @param y0 top left coordinate of the bitmap, y-axis, may be negative
+    /// @param x1 top left coordinate of the area to draw, x-axis
+    /// @param y1 top left coordinate of the area to draw, y-axis
+    /// @param x2 bottom right coordinate of the area to draw, x-axis
+    /// @param y2 bottom right coordinate of the area to draw, y-axis
+    /// @param bitmap bitmap
+    /// @note Blocks of 8 rows by 8 bits, physical coordinates
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    void _setBitmap(int16_t x0, int16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, const bitmap_s & bitmap);
+
+    ///
+    /// @brief Get bitmap format matching the bytes of the frame-buffer
+    /// @return BITMAP_ROW for orientations 0 and 2, BITMAP_COLUMN for orientations 1 and 3
+    ///
+    uint8_t _getNativeFormat();
+
+    ///
+    /// @brief Set byte of both pages with three inks
+    /// @param z1 index for _newImage[]
+    /// @param parity physical row, even = 0, odd = 1
+    /// @param mask bits to write
+    /// @param bits0 bits with first ink
+    /// @param bits1 bits with second ink
+    /// @param bits2 bits with third ink
+    /// @param inks three inks
+    ///
+    void _setInkByte(uint32_t z1, uint8_t parity, uint8_t mask, uint8_t bits0, uint8_t bits1, uint8_t bits2, const ink_s * inks);
+
+    ///
+    /// @brief Convert colour into basic colour
+    /// @param colour 16-bit colour
+    /// @param flagOdd true if x1 + y1 is even, physical coordinates
+    /// @return physical value, black page bit 4, red page bit 0, 0xff if not drawn
+    ///
+    uint8_t _getBasicColour(uint16_t colour, bool flagOdd);
+
+    ///
+    /// @brief Resolve colour into ink
+    /// @param colour 16-bit colour
+    /// @return patterns for black and red pages
+    /// @note Last colour is kept, so each primitive resolves its colour once
+    ///
+    const ink_s & _getInk(uint16_t colour);
+
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+    ///
+    /// @brief Mark dirty tiles, physical coordinates
+    /// @param x1 first row, physical x-axis
+    /// @param y1 first bit, physical y-axis
+    /// @param x2 last row, physical x-axis, x1 <= x2
+    /// @param y2 last bit, physical y-axis, y1 <= y2
+    ///
+    void _setDirty(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+#endif // DIRTY_MODE
+
     ///
     /// @brief Convert
     /// @param x1 x-axis coordinate
@@ -258,9 +526,10 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer
 
     ///
     /// @brief Wait for ready
-    /// @details Wait for _pin.panelBusy low
+    /// @details Wait for _pin.panelBusy HIGH, calling the hook set by setBusyWait()
+    /// @return false = success, true = timeout
     ///
-    void _waitBusy();
+    bool _waitBusy();
     void _sendCommand8(uint8_t command);
 
     // Energy
@@ -270,9 +539,87 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer
     // * Flush
     void _flushGlobal();
 
+    ///
+    /// @brief Run current step of global update
+    /// @note Sets next step, 0 = completed, and the wait before it
+    ///
+    void _flushGlobalStep();
+
+    ///
+    /// @brief Set wait before next step
+    /// @param ms delay, ms
+    /// @param flagBusy true = then wait for _pin.panelBusy HIGH
+    /// @param phase FLUSH_PHASE_NONE, FLUSH_PHASE_REFRESH or FLUSH_PHASE_OFF, for prediction
+    ///
+    void _flushWait(uint32_t ms, bool flagBusy = false, uint8_t phase = FLUSH_PHASE_NONE);
+
+    ///
+    /// @brief Temperature band for prediction
+    /// @return 0..PREDICTION_BANDS - 1
+    ///
+    uint8_t _predictBand();
+
+    ///
+    /// @brief Time to sleep before polling BUSY
+    /// @return ms until PREDICTION_MARGIN % before predicted end of current wait, 0 = poll now
+    ///
+    uint32_t _predictSleep();
+
+    ///
+    /// @brief Learn duration of current wait
+    /// @note Called when BUSY is HIGH, duration since _flushChrono
+    ///
+    void _predictLearn();
+
+    ///
+    /// @brief Send one step of DC-DC soft-start
+    /// @param step 0..29
+    ///
+    void _flushSoftStart(uint8_t step);
+
+    ///
+    /// @brief Resolve fast pin
+    /// @param[out] fast pin with registers, or for digitalWrite()
+    /// @param pin pin number, set as OUTPUT
+    ///
+    void _fastPinBegin(fastPin_s & fast, uint8_t pin);
+
+    ///
+    /// @brief Write fast pin
+    /// @param fast pin from _fastPinBegin()
+    /// @param value LOW or HIGH
+    ///
+    void _fastWrite(const fastPin_s & fast, uint8_t value);
+
+    fastPin_s _fastDC; // panelDC
+    fastPin_s _fastCS; // panelCS
+    fastPin_s _fastCSS; // panelCSS
+
+    uint8_t _flushStep = 0; // 0 = no update in progress
+    uint8_t _flushCount; // steps of DC-DC soft-start
+    uint32_t _flushChrono; // start of wait, ms
+    uint32_t _flushDelay; // delay, ms
+    bool _flushBusy; // wait for BUSY after delay
+    void (*_flushCallback)() = 0;
+    uint8_t _flushResult = RESULT_SUCCESS;
+    void (*_busyHook)() = 0;
+#if (BUSY_WAIT_MODE == USE_BUSY_INTERRUPT)
+    volatile bool _busyEdge = false; // set by rising edge of BUSY
+#endif // BUSY_WAIT_MODE
+    uint32_t _busyTimeout = BUSY_TIMEOUT;
+    uint8_t _flushPhase = FLUSH_PHASE_NONE; // phase of current wait
+    uint16_t _predictDuration[2][PREDICTION_BANDS] = { 0 }; // refresh and DC-DC off, ms, 0 = unknown
+
     // Screen independent variables
     uint8_t * _newImage;
     bool _invert = false;
+    ink_s _ink; // last resolved colour
+    uint16_t _inkColour;
+    bool _inkValid = false;
+#if (DIRTY_MODE == USE_DIRTY_TILES)
+    uint8_t * _dirtyMap = 0; // 1 bit per tile
+    uint16_t _dirtySizeX, _dirtySizeY; // number of tiles
+#endif // DIRTY_MODE
     uint16_t _screenSizeV, _screenSizeH;
     int8_t _temperature = 25;
 
@@ -285,10 +632,25 @@ class Screen_EPD_EXT3 final : public hV_Screen_Buffer
     uint16_t _bufferSizeV, _bufferSizeH, _bufferDepth;
     uint32_t _pageColourSize, _frameSize;
 
+    // Addressing, per layout set by begin(), per orientation set by _setOrientation()
+    uint16_t _addressStride; // bytes per physical row
+    uint16_t _addressSplit; // first physical y of second half, 0xffff if none
+    uint16_t _addressSizeX, _addressSizeY; // logical sizes
+    uint16_t _addressBaseX, _addressBaseY; // physical coordinates of logical (0, 0)
+    int8_t _addressXX, _addressXY; // physical steps for logical x + 1
+    int8_t _addressYX, _addressYY; // physical steps for logical y + 1
+    bool _addressSwap; // logical x along physical y
+    bool _addressFlipX, _addressFlipY; // physical coordinates decreasing from base
+
     // === Touch
     // No touch
 
     /// @endcond
 };
 
+#if (USE_hV_SCREEN == USE_hV_SCREEN_STATIC)
+// Instantiated in Screen_EPD_EXT3.cpp
+extern template class hV_Screen_Static<Screen_EPD_EXT3>;
+#endif // USE_hV_SCREEN
+
 #endif // SCREEN_EPD_EXT3_RELEASE
@@ -0,0 +1,284 @@
+///
+/// @file Terminal12x16p.h
+/// @brief Font Terminal 12 x 16, packed
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 16 Oct 2026
+/// @version 523
+///
+/// @copyright (c) Rei Vilo, 2010-2023
+/// @copyright All rights reserved
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+
+//
+// Terminal12x16p.h
+// Font library
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+
+#ifndef TERMINAL12P_FONT_RELEASE
+///
+/// @brief Release
+///
+#define TERMINAL12P_FONT_RELEASE 523
+
+///
+/// @brief Font Terminal12x16, packed
+/// @details Same glyphs as Terminal12x16e.h, 3256 bytes instead of 5376
+/// @n Per character
+/// * 1 byte, first column << 4 | (number of columns - 1), 0xff = blank
+/// * 1 byte, first row << 4 | (number of rows - 1)
+/// * bitstream, columns of rows, first bit on LSB
+///
+static const uint8_t Terminal12x16p[3256] =
+{
+    0xFF, // Code for char space
+    0x43, 0x0D, 0x7C, 0xC0, 0xFF, 0xFC, 0x3F, 0xF3, 0x01, // Code for char !
+    0x35, 0x23, 0xFF, 0x00, 0xFF, // Code for char "
+    0x1A, 0x1B, 0x00, 0x81, 0xF0, 0xC8, 0x8F, 0x1F, 0x3F, 0xF1, 0xF0, 0xC8, 0x8F, 0x1F, 0x3F, 0xF1, 0x00, 0x08, 0x00, // Code for char #
+    0x27, 0x0D, 0x78, 0x04, 0x3F, 0xC3, 0xCC, 0xFC, 0xFF, 0xFF, 0x3F, 0x33, 0xC3, 0xFC, 0x20, 0x1E, // Code for char $
+    0x1A, 0x3A, 0x00, 0x3E, 0xF8, 0xE1, 0x8E, 0x03, 0x0E, 0x38, 0xE0, 0x80, 0xE3, 0x0E, 0x3F, 0xF8, 0x00, 0x00, // Code for char %
+    0x28, 0x1C, 0x80, 0x8F, 0xFB, 0xFB, 0xE3, 0x71, 0x18, 0xBF, 0x3F, 0x9E, 0x83, 0x03, 0xD8, 0x00, 0x11, // Code for char &
+    0x42, 0x05, 0xE7, 0xFF, 0x01, // Code for char '
+    0x35, 0x0D, 0xF0, 0x03, 0xFF, 0xE3, 0xFF, 0x1D, 0xE0, 0x01, 0x60, 0x00, 0x08, // Code for char (
+    0x35, 0x0D, 0x01, 0x60, 0x00, 0x78, 0x80, 0xFB, 0x7F, 0xFC, 0x0F, 0xFC, 0x00, // Code for char )
+    0x27, 0x38, 0x93, 0xAF, 0xF3, 0xF9, 0xFF, 0x9F, 0xCF, 0xF5, 0xC9, // Code for char *
+    0x27, 0x47, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, // Code for char +
+    0x42, 0xB4, 0xF7, 0x3F, // Code for char ,
+    0x27, 0x71, 0xFF, 0xFF, // Code for char -
+    0x42, 0xB2, 0xFF, 0x01, // Code for char .
+    0x1A, 0x1B, 0x00, 0x0C, 0xE0, 0x00, 0x07, 0x38, 0xC0, 0x01, 0x0E, 0x70, 0x80, 0x03, 0x1C, 0xE0, 0x00, 0x07, 0x00, // Code for char /
+    0x1A, 0x0D, 0xF8, 0x87, 0xFF, 0x67, 0xE0, 0x0D, 0xCC, 0x83, 0xF1, 0x30, 0x3C, 0x06, 0xCF, 0xC0, 0x1E, 0x98, 0xFF, 0x87, 0x7F, 0x00, // Code for char 0
+    0x37, 0x0D, 0x0C, 0x30, 0x03, 0xEC, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x0C, 0x00, 0x03, 0xC0, // Code for char 1
+    0x1A, 0x0D, 0x1C, 0xB0, 0x07, 0x7E, 0xC0, 0x0F, 0xF8, 0x03, 0xF7, 0xE0, 0x3C, 0x1C, 0x8F, 0xC3, 0x77, 0xB0, 0x0F, 0xCC, 0x01, 0x03, // Code for char 2
+    0x1A, 0x0D, 0x0C, 0x8C, 0x03, 0x77, 0x80, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0xC3, 0xE7, 0xB9, 0xDF, 0xC7, 0xE3, 0x00, // Code for char 3
+    0x1A, 0x0D, 0xC0, 0x03, 0xF8, 0x00, 0x37, 0xE0, 0x0C, 0x1C, 0x83, 0xC3, 0x70, 0x30, 0xFC, 0xFF, 0xFF, 0x3F, 0xC0, 0x00, 0x30, 0x00, // Code for char 4
+    0x1A, 0x0D, 0x3F, 0xCC, 0x1F, 0x37, 0x86, 0x8F, 0xC1, 0x63, 0xF0, 0x18, 0x3C, 0x06, 0x8F, 0xC1, 0xE3, 0xF8, 0xF0, 0x37, 0xF8, 0x00, // Code for char 5
+    0x1A, 0x0D, 0xC0, 0x0F, 0xFC, 0x87, 0x9F, 0x73, 0xC3, 0xCE, 0xF0, 0x31, 0x3C, 0x0C, 0x0F, 0xC3, 0xC3, 0x39, 0xE0, 0x07, 0xF0, 0x00, // Code for char 6
+    0x1A, 0x0D, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0xC0, 0x03, 0xFC, 0xC0, 0x33, 0x3C, 0xCC, 0x03, 0x3F, 0xC0, 0x03, 0x30, 0x00, 0x00, // Code for char 7
+    0x1A, 0x0D, 0x00, 0x0F, 0xEF, 0xE7, 0x9F, 0x9F, 0xC3, 0xC3, 0xF0, 0x30, 0x3C, 0x0C, 0x9F, 0xC3, 0xFE, 0x39, 0xEF, 0x07, 0xF0, 0x00, // Code for char 8
+    0x1A, 0x0D, 0x3C, 0x80, 0x1F, 0x70, 0x0E, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x3E, 0xCC, 0x0D, 0x3B, 0xE7, 0x87, 0xFF, 0xC0, 0x0F, 0x00, // Code for char 9
+    0x42, 0x48, 0xC7, 0x8F, 0x1F, 0x07, // Code for char :
+    0x42, 0x4B, 0xC7, 0x79, 0xFC, 0xC7, 0x07, // Code for char ;
+    0x27, 0x0D, 0xC0, 0x00, 0x78, 0x00, 0x3F, 0xE0, 0x1C, 0x1C, 0x8E, 0x03, 0x77, 0x80, 0x0F, 0xC0, // Code for char <
+    0x28, 0x55, 0xF3, 0x3C, 0xCF, 0xF3, 0x3C, 0xCF, 0x33, // Code for char =
+    0x27, 0x0D, 0x03, 0xF0, 0x01, 0xEE, 0xC0, 0x71, 0x38, 0x38, 0x07, 0xFC, 0x00, 0x1E, 0x00, 0x03, // Code for char >
+    0x19, 0x0D, 0x1C, 0x80, 0x07, 0x70, 0x00, 0x0C, 0x00, 0x83, 0xF7, 0xF0, 0x3D, 0x0E, 0xDC, 0x01, 0x3E, 0x00, 0x07, 0x00, // Code for char ?
+    0x1A, 0x0D, 0xF8, 0x8F, 0xFF, 0x77, 0x80, 0xCD, 0xCF, 0xFB, 0xF7, 0x86, 0xBD, 0x7F, 0xEF, 0xDF, 0x07, 0xB6, 0xFF, 0x80, 0x1F, 0x00, // Code for char @
+    0x19, 0x0D, 0x00, 0x38, 0xC0, 0x0F, 0x7E, 0xF0, 0x1B, 0x1F, 0xC6, 0x87, 0xC1, 0x6F, 0x80, 0x1F, 0x00, 0x3F, 0x00, 0x0E, // Code for char A
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x7C, 0x0E, 0xFB, 0xE7, 0xBC, 0x1F, 0xC0, 0x03, // Code for char B
+    0x19, 0x0D, 0xF0, 0x03, 0xFF, 0xE3, 0xC0, 0x1D, 0xE0, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0xE0, 0x0E, 0x1C, 0x03, 0x03, // Code for char C
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7C, 0x80, 0x3B, 0x70, 0xFC, 0x0F, 0xFC, 0x00, // Code for char D
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0xC3, 0x03, 0xF0, 0x00, 0x0C, // Code for char E
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0C, 0x03, 0xC3, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0xC0, 0x00, 0x00, // Code for char F
+    0x19, 0x0D, 0xF0, 0x03, 0xFF, 0xE3, 0xC0, 0x1D, 0xE0, 0x03, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0xC3, 0xC7, 0xBF, 0xF1, 0x0F, // Code for char G
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x0F, // Code for char H
+    0x35, 0x0D, 0x03, 0xF0, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0x0C, // Code for char I
+    0x19, 0x0D, 0x00, 0x0E, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xE0, 0xFF, 0xDF, 0xFF, 0x01, // Code for char J
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x80, 0x07, 0xF0, 0x03, 0xCE, 0xC1, 0xE1, 0x38, 0x70, 0x07, 0xF8, 0x00, 0x0C, // Code for char K
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, // Code for char L
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0x78, 0x80, 0x07, 0x78, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, // Code for char M
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0F, // Code for char N
+    0x19, 0x0D, 0xF0, 0x03, 0xFF, 0xE3, 0xC0, 0x1D, 0xE0, 0x03, 0xF0, 0x00, 0x7C, 0x80, 0x3B, 0x70, 0xFC, 0x0F, 0xFC, 0x00, // Code for char O
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x3F, 0x18, 0x0C, 0x06, 0x83, 0xC1, 0x60, 0x30, 0x18, 0x1C, 0x07, 0xFE, 0x00, 0x1F, 0x00, // Code for char P
+    0x19, 0x0D, 0xF0, 0x03, 0xFF, 0xE3, 0xC0, 0x1D, 0xE0, 0x03, 0xF0, 0x80, 0x7D, 0xE0, 0x3B, 0x70, 0xFC, 0x3F, 0xFC, 0x0C, // Code for char Q
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x3F, 0x18, 0x0C, 0x06, 0x83, 0xC3, 0xE0, 0x31, 0xF8, 0x1C, 0x77, 0xFE, 0x38, 0x1F, 0x0C, // Code for char R
+    0x19, 0x0D, 0x3C, 0x8C, 0x1F, 0x77, 0x8E, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x3C, 0x0C, 0x1F, 0xE7, 0x8E, 0x1F, 0xC3, 0x03, // Code for char S
+    0x27, 0x0D, 0x03, 0xC0, 0x00, 0x30, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x30, 0x00, 0x0C, 0x00, // Code for char T
+    0x19, 0x0D, 0xFF, 0xC7, 0xFF, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xE0, 0xFF, 0xDF, 0xFF, 0x01, // Code for char U
+    0x19, 0x0D, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3F, 0x00, 0x3E, 0x80, 0x0F, 0xFC, 0xE0, 0x07, 0x3F, 0xC0, 0x01, 0x00, // Code for char V
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0x01, 0x18, 0x80, 0x03, 0xE0, 0x00, 0x60, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x0F, // Code for char W
+    0x19, 0x0D, 0x03, 0xF0, 0x03, 0xCF, 0xE1, 0xC0, 0x0C, 0xE0, 0x01, 0x78, 0x00, 0x33, 0x70, 0x38, 0x0F, 0xFC, 0x00, 0x0C, // Code for char X
+    0x19, 0x0D, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x3F, 0xF0, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, // Code for char Y
+    0x19, 0x0D, 0x03, 0xF0, 0x00, 0x3F, 0xE0, 0x0F, 0xCC, 0xC3, 0xF1, 0x38, 0x3C, 0x03, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x0C, // Code for char Z
+    0x35, 0x0D, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x0C, // Code for char [
+    0x1A, 0x1B, 0x07, 0xE0, 0x00, 0x1C, 0x80, 0x03, 0x70, 0x00, 0x0E, 0xC0, 0x01, 0x38, 0x00, 0x07, 0xE0, 0x00, 0x0C, // Code for char 0x5C
+    0x35, 0x0D, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, // Code for char ]
+    0x1A, 0x06, 0x60, 0x38, 0x8E, 0xE3, 0x38, 0x38, 0x38, 0x38, 0x38, 0x18, // Code for char ^
+    0x1A, 0xE1, 0xFF, 0xFF, 0x3F, // Code for char _
+    0x52, 0x15, 0xDF, 0x7F, 0x02, // Code for char `
+    0x19, 0x58, 0xE0, 0xE4, 0x6F, 0xDE, 0xBC, 0x79, 0xF3, 0xE6, 0xCD, 0xFF, 0xFD, 0x03, // Code for char a
+    0x19, 0x0D, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x83, 0xC1, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x83, 0xE3, 0xC0, 0x1F, 0xE0, 0x03, // Code for char b
+    0x19, 0x58, 0x7C, 0xFC, 0x1D, 0x1F, 0x3C, 0x78, 0xF0, 0xE0, 0xC1, 0xC6, 0x88, 0x00, // Code for char c
+    0x19, 0x0D, 0x80, 0x0F, 0xF0, 0x07, 0x8E, 0x83, 0xC1, 0x60, 0x30, 0x18, 0x0C, 0x0E, 0x03, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, // Code for char d
+    0x19, 0x58, 0x7C, 0xFC, 0x7D, 0xDF, 0xBC, 0x79, 0xF3, 0xE6, 0xCD, 0x9E, 0x18, 0x00, // Code for char e
+    0x17, 0x0D, 0xC0, 0x00, 0x30, 0xC0, 0xFF, 0xFB, 0xFF, 0xC7, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x00, // Code for char f
+    0x19, 0x5A, 0x1C, 0xF0, 0xF1, 0x9D, 0xC7, 0x3C, 0xE6, 0x31, 0x8F, 0x79, 0xE6, 0xFF, 0xFB, 0x0F, // Code for char g
+    0x18, 0x0D, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x80, 0x01, 0x60, 0x00, 0x18, 0x00, 0x0E, 0x00, 0xFF, 0x80, 0x3F, // Code for char h
+    0x35, 0x2B, 0x00, 0x8C, 0xC1, 0xFB, 0xBF, 0xFF, 0x00, 0x0C, 0xC0, // Code for char i
+    0x35, 0x2D, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x63, 0xC0, 0xFB, 0xFF, 0xFE, 0x07, // Code for char j
+    0x27, 0x0D, 0xFF, 0xFF, 0xFF, 0x0F, 0x30, 0x00, 0x1E, 0xC0, 0x0F, 0x38, 0x07, 0x86, 0x03, 0xC0, // Code for char k
+    0x35, 0x0D, 0x00, 0xF0, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x30, 0x00, 0x0C, // Code for char l
+    0x19, 0x58, 0xFF, 0xFD, 0x1F, 0x38, 0xE0, 0xDF, 0xFF, 0x81, 0x03, 0xFE, 0xF9, 0x03, // Code for char m
+    0x28, 0x58, 0xFF, 0xFF, 0x0F, 0x18, 0x30, 0x60, 0xC0, 0x01, 0xFF, 0xFC, 0x01, // Code for char n
+    0x19, 0x58, 0x7C, 0xFC, 0x1D, 0x1F, 0x3C, 0x78, 0xF0, 0xE0, 0xE3, 0xFE, 0xF8, 0x00, // Code for char o
+    0x19, 0x5A, 0xFF, 0xFF, 0xFF, 0x18, 0x86, 0x31, 0x8C, 0x61, 0x0C, 0xE3, 0x1C, 0x7E, 0xE0, 0x01, // Code for char p
+    0x19, 0x5A, 0x3C, 0xF0, 0xC3, 0x39, 0x86, 0x31, 0x8C, 0x61, 0x0C, 0x63, 0x0C, 0xFF, 0xFF, 0x3F, // Code for char q
+    0x28, 0x58, 0xFF, 0xFF, 0x1B, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x03, 0x06, 0x00, // Code for char r
+    0x17, 0x58, 0x8E, 0x3E, 0x6F, 0xDE, 0xBC, 0x79, 0xF3, 0x7E, 0x79, // Code for char s
+    0x17, 0x1C, 0x30, 0x00, 0x06, 0xFC, 0xBF, 0xFF, 0x0F, 0x83, 0x61, 0x30, 0x0C, 0x06, 0xC0, // Code for char t
+    0x19, 0x58, 0x7F, 0xFE, 0x01, 0x07, 0x0C, 0x18, 0x30, 0x60, 0x60, 0xFF, 0xFF, 0x03, // Code for char u
+    0x19, 0x58, 0x03, 0x1E, 0xF0, 0x80, 0x07, 0x1C, 0x38, 0x3C, 0x1E, 0x0F, 0x06, 0x00, // Code for char v
+    0x19, 0x58, 0x3F, 0xFE, 0x01, 0x07, 0xF7, 0xE7, 0x0F, 0x38, 0xE0, 0xFF, 0x7E, 0x00, // Code for char w
+    0x18, 0x58, 0x83, 0x8F, 0xBB, 0xE3, 0x83, 0x83, 0x8F, 0xBB, 0xE3, 0x83, 0x01, // Code for char x
+    0x27, 0x5A, 0x03, 0x78, 0x20, 0xCF, 0xE1, 0x07, 0x0F, 0x1E, 0x3C, 0x60, 0x00, // Code for char y
+    0x18, 0x58, 0x83, 0x87, 0x8F, 0x9F, 0xBD, 0xF9, 0xF1, 0xE1, 0xC1, 0x81, 0x01, // Code for char z
+    0x27, 0x0E, 0x80, 0x00, 0xE0, 0x00, 0xFF, 0xC7, 0xEF, 0x77, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, // Code for char {
+    0x51, 0x0D, 0xBF, 0xFF, 0xEF, 0x0F, // Code for char |
+    0x27, 0x0E, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xEE, 0xF7, 0xE3, 0xFF, 0x00, 0x07, 0x00, 0x01, // Code for char }
+    0x19, 0x22, 0xF4, 0x32, 0xD3, 0x0B, // Code for char ~
+    0x19, 0x47, 0xF0, 0xF8, 0xCC, 0xC6, 0xC3, 0xC3, 0xC6, 0xCC, 0xF8, 0xF0, // Code for char 0x7F
+    0x19, 0x0D, 0x20, 0x01, 0xFC, 0xC0, 0xFF, 0xB8, 0x74, 0x27, 0xF9, 0x48, 0x3C, 0x02, 0x1F, 0xF0, 0x06, 0x1C, 0x00, 0x02, // Code for char 0x80
+    0xFF, // Code for char 0x81
+    0x52, 0x95, 0xE7, 0xFF, 0x01, // Code for char 0x82
+    0x18, 0x1C, 0x00, 0x08, 0x04, 0xC3, 0x7C, 0xF8, 0xE7, 0x1F, 0x7E, 0xC0, 0x0C, 0x98, 0x00, 0x02, 0x00, // Code for char 0x83
+    0x36, 0x95, 0xE7, 0xFF, 0x01, 0xE7, 0xFF, 0x01, // Code for char 0x84
+    0x1A, 0xB2, 0xFF, 0xF1, 0x1F, 0xFF, 0x01, // Code for char 0x85
+    0x27, 0x1C, 0x18, 0x00, 0x03, 0x60, 0x80, 0xFF, 0xFF, 0xFF, 0x31, 0x00, 0x06, 0xC0, 0x00, // Code for char 0x86
+    0x27, 0x1C, 0x18, 0x03, 0x63, 0x60, 0x8C, 0xFF, 0xFF, 0xFF, 0x31, 0x06, 0xC6, 0xC0, 0x18, // Code for char 0x87
+    0x35, 0x22, 0xF4, 0x66, 0x02, // Code for char 0x88
+    0x1A, 0x3A, 0x00, 0x3E, 0xF8, 0xE1, 0x8E, 0x03, 0x0E, 0x38, 0xE0, 0x9C, 0xE3, 0x0E, 0x38, 0xF8, 0xC0, 0x01, // Code for char 0x89
+    0x19, 0x0D, 0x70, 0x0C, 0x3E, 0xC7, 0x9D, 0x37, 0xC6, 0x8F, 0xB1, 0x63, 0xFC, 0x18, 0x77, 0xEE, 0x38, 0x1F, 0x8C, 0x03, // Code for char 0x8A
+    0x33, 0x54, 0xC4, 0xED, 0x08, // Code for char 0x8B
+    0x19, 0x0D, 0xF0, 0x03, 0xFF, 0xE3, 0xC0, 0x1D, 0xE0, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xC3, 0xC3, 0xF0, 0x00, 0x0C, // Code for char 0x8C
+    0xFF, // Code for char 0x8D
+    0x19, 0x0D, 0x18, 0x30, 0x06, 0x9E, 0xC1, 0x6F, 0xD8, 0x1E, 0xB3, 0x67, 0xBC, 0x0D, 0xE7, 0xC1, 0x38, 0x30, 0x06, 0x0C, // Code for char 0x8E
+    0xFF, // Code for char 0x8F
+    0xFF, // Code for char 0x90
+    0x52, 0x15, 0xFE, 0x9F, 0x03, // Code for char 0x91
+    0x52, 0x15, 0xE7, 0xFF, 0x01, // Code for char 0x92
+    0x36, 0x15, 0xFE, 0x9F, 0x03, 0xFE, 0x9F, 0x03, // Code for char 0x93
+    0x36, 0x15, 0xE7, 0xFF, 0x01, 0xE7, 0xFF, 0x01, // Code for char 0x94
+    0x44, 0x54, 0xEE, 0xFF, 0xEF, 0x00, // Code for char 0x95
+    0x35, 0x61, 0xFF, 0x0F, // Code for char 0x96
+    0x19, 0x61, 0xFF, 0xFF, 0x0F, // Code for char 0x97
+    0x36, 0x61, 0xDE, 0x1E, // Code for char 0x98
+    0x19, 0x14, 0x21, 0xFC, 0x10, 0xBE, 0x20, 0xE2, 0x03, // Code for char 0x99
+    0x17, 0x2B, 0x70, 0x84, 0xCF, 0xD8, 0x9C, 0xCD, 0xDA, 0x9C, 0xCD, 0xD8, 0x0F, 0x79, // Code for char 0x9A
+    0x43, 0x54, 0x71, 0x3B, 0x02, // Code for char 0x9B
+    0x1A, 0x58, 0x7C, 0xFC, 0x1D, 0x1F, 0x7C, 0xDC, 0xDF, 0xE6, 0xCD, 0x9B, 0x3D, 0x31, 0x00, // Code for char 0x9C
+    0xFF, // Code for char 0x9D
+    0x18, 0x2B, 0x18, 0x8C, 0xE1, 0x18, 0x9F, 0xD9, 0xDA, 0x9C, 0xC7, 0x38, 0x8C, 0xC1, 0x08, 0x0C, // Code for char 0x9E
+    0x19, 0x0D, 0x08, 0x00, 0x06, 0x30, 0x03, 0x8C, 0x01, 0xC0, 0x3F, 0xF0, 0x3F, 0x06, 0xCC, 0x00, 0x18, 0x00, 0x02, 0x00, // Code for char 0x9F
+    0xFF, // Code for char 0xA0
+    0x43, 0x2D, 0x80, 0xCF, 0xFC, 0x3F, 0xFF, 0x03, 0x3E, // Code for char 0xA1
+    0x27, 0x1C, 0xF0, 0x01, 0x7F, 0x70, 0x9C, 0xFF, 0xFF, 0xFF, 0x19, 0x0C, 0xC7, 0xC1, 0x18, // Code for char 0xA2
+    0x28, 0x1B, 0x40, 0x04, 0xE6, 0xFC, 0xEF, 0x7F, 0x67, 0x36, 0x66, 0x63, 0x6E, 0xC2, 0x04, 0x04, // Code for char 0xA3
+    0x19, 0x1B, 0xFB, 0xFD, 0xFF, 0x0C, 0x63, 0x60, 0x06, 0x66, 0x60, 0x06, 0xC6, 0x30, 0xFF, 0xBF, 0xDF, // Code for char 0xA4
+    0x19, 0x0D, 0x03, 0xC0, 0x83, 0xC2, 0xA3, 0xC0, 0x2B, 0xC0, 0x3F, 0xF0, 0x0F, 0xAF, 0xF0, 0x28, 0x0F, 0xCA, 0x00, 0x00, // Code for char 0xA5
+    0x51, 0x0D, 0x3F, 0xFF, 0xCF, 0x0F, // Code for char 0xA6
+    0x27, 0x1B, 0x6E, 0xF4, 0xCF, 0x91, 0x18, 0x89, 0x91, 0x18, 0x89, 0xF3, 0x2F, 0x76, // Code for char 0xA7
+    0x35, 0x21, 0x0F, 0x0F, // Code for char 0xA8
+    0x1A, 0x2A, 0xFC, 0xF1, 0xDF, 0xC1, 0xE7, 0xBC, 0xEF, 0x45, 0x6F, 0x7B, 0xCA, 0x07, 0xF7, 0x1F, 0x7F, 0x00, // Code for char 0xA9
+    0x19, 0x0A, 0x70, 0xD0, 0xF7, 0xB6, 0xB7, 0xBD, 0xED, 0x6D, 0x6F, 0x7B, 0xDB, 0xFF, 0xF6, 0x07, // Code for char 0xAA
+    0x18, 0x54, 0xC4, 0xED, 0x08, 0x88, 0xDB, 0x11, // Code for char 0xAB
+    0x27, 0x64, 0x63, 0x8C, 0x31, 0xC6, 0xFF, // Code for char 0xAC
+    0x35, 0x71, 0xFF, 0x0F, // Code for char 0xAD
+    0x1A, 0x2A, 0xFC, 0xF1, 0xDF, 0xC1, 0xF7, 0xBD, 0xEF, 0x15, 0xEF, 0x7B, 0xDA, 0x07, 0xF7, 0x1F, 0x7F, 0x00, // Code for char 0xAE
+    0x19, 0x21, 0xFF, 0xFF, 0x0F, // Code for char 0xAF
+    0x35, 0x05, 0xDE, 0x3F, 0xCF, 0xBF, 0x07, // Code for char 0xB0
+    0x35, 0x48, 0x8C, 0x19, 0xFF, 0xFE, 0xCD, 0x98, 0x31, // Code for char 0xB1
+    0x24, 0x04, 0xB9, 0xD7, 0x2B, 0x01, // Code for char 0xB2
+    0x24, 0x04, 0xB1, 0xD6, 0xAF, 0x00, // Code for char 0xB3
+    0x43, 0x22, 0xF4, 0x02, // Code for char 0xB4
+    0x18, 0x4B, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x0C, 0xC0, 0x00, 0x0C, 0xE0, 0xF0, 0x07, 0x3F, 0x00, // Code for char 0xB5
+    0x19, 0x1C, 0x1C, 0xC0, 0x07, 0x8C, 0x81, 0x20, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0x00, // Code for char 0xB6
+    0x43, 0x73, 0xF6, 0x6F, // Code for char 0xB7
+    0x43, 0xC1, 0xFA, // Code for char 0xB8
+    0x22, 0x04, 0xE2, 0x7F, // Code for char 0xB9
+    0x23, 0x04, 0x2E, 0x46, 0x07, // Code for char 0xBA
+    0x18, 0x54, 0x71, 0x3B, 0x02, 0xE2, 0x76, 0x04, // Code for char 0xBB
+    0x19, 0x2A, 0x12, 0xF8, 0xC8, 0x67, 0xA0, 0x01, 0x06, 0xD8, 0x60, 0x87, 0x21, 0xC4, 0x07, 0x3E, // Code for char 0xBC
+    0x19, 0x2A, 0x12, 0xF8, 0xC8, 0x67, 0xA0, 0x01, 0x06, 0x18, 0x60, 0x99, 0xE9, 0xC4, 0x05, 0x24, // Code for char 0xBD
+    0x19, 0x2A, 0x11, 0xA8, 0xC8, 0x67, 0x94, 0x01, 0x06, 0xD8, 0x60, 0x87, 0x21, 0xC4, 0x07, 0x3E, // Code for char 0xBE
+    0x19, 0x0D, 0x00, 0x0E, 0xC0, 0x07, 0xB8, 0x03, 0xC7, 0xFB, 0xF0, 0x1E, 0x0C, 0x00, 0x03, 0xE0, 0x00, 0x1E, 0x80, 0x03, // Code for char 0xBF
+    0x19, 0x0D, 0x00, 0x38, 0x80, 0x0F, 0xF8, 0x84, 0x37, 0x73, 0x8C, 0x1D, 0x43, 0xDE, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x0E, // Code for char 0xC0
+    0x19, 0x0D, 0x00, 0x38, 0x80, 0x0F, 0xF8, 0x90, 0x37, 0x76, 0xCC, 0x1C, 0x13, 0xDE, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x0E, // Code for char 0xC1
+    0x19, 0x0D, 0x00, 0x38, 0x80, 0x4F, 0xF8, 0x98, 0x37, 0x73, 0xCC, 0x1C, 0x63, 0xDE, 0x10, 0x3E, 0x00, 0x3E, 0x00, 0x0E, // Code for char 0xC2
+    0x19, 0x0D, 0x00, 0x38, 0x80, 0x2F, 0xF8, 0x8C, 0x37, 0x79, 0xCC, 0x1E, 0x23, 0xDE, 0x0C, 0x3E, 0x01, 0x3E, 0x00, 0x0E, // Code for char 0xC3
+    0x19, 0x0D, 0x00, 0x38, 0x80, 0x3F, 0xF8, 0x8C, 0x37, 0x78, 0x0C, 0x1E, 0x33, 0xDE, 0x0C, 0x3E, 0x00, 0x3E, 0x00, 0x0E, // Code for char 0xC4
+    0x19, 0x0D, 0x00, 0x38, 0x80, 0x0F, 0xF8, 0x88, 0x37, 0x75, 0x4C, 0x1D, 0x23, 0xDE, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x0E, // Code for char 0xC5
+    0x19, 0x0D, 0x00, 0x38, 0xC0, 0x0F, 0x7E, 0xF0, 0x1B, 0x1F, 0xC6, 0xFF, 0xFF, 0xFF, 0x0F, 0xC3, 0xC3, 0xF0, 0x00, 0x0C, // Code for char 0xC6
+    0x19, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0x0E, 0x1C, 0x07, 0x38, 0x03, 0xB0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0x38, 0x0E, 0x1C, 0x0C, 0x0C, // Code for char 0xC7
+    0x19, 0x0D, 0xF8, 0x3F, 0xFE, 0x9F, 0x19, 0x6F, 0xC6, 0x9E, 0x31, 0x67, 0x8C, 0x19, 0x63, 0xC6, 0x18, 0x30, 0x06, 0x0C, // Code for char 0xC8
+    0x19, 0x0D, 0xF8, 0x3F, 0xFE, 0x8F, 0x19, 0x63, 0xC6, 0x9C, 0xB1, 0x67, 0xBC, 0x19, 0x67, 0xC6, 0x18, 0x30, 0x06, 0x0C, // Code for char 0xC9
+    0x19, 0x0D, 0xF8, 0x3F, 0xFE, 0xCF, 0x19, 0x7B, 0xC6, 0x9B, 0xF1, 0x66, 0xEC, 0x19, 0x73, 0xC6, 0x18, 0x30, 0x06, 0x0C, // Code for char 0xCA
+    0x19, 0x0D, 0xF8, 0x3F, 0xFE, 0xBF, 0x19, 0x6F, 0xC6, 0x98, 0x31, 0x66, 0xBC, 0x19, 0x6F, 0xC6, 0x18, 0x30, 0x06, 0x0C, // Code for char 0xCB
+    0x35, 0x0D, 0x19, 0xF0, 0x06, 0xEC, 0xFF, 0xF3, 0xFF, 0x18, 0x30, 0x06, 0x0C, // Code for char 0xCC
+    0x35, 0x0D, 0x18, 0x30, 0x06, 0xCC, 0xFF, 0xFB, 0xFF, 0x1B, 0x70, 0x06, 0x0C, // Code for char 0xCD
+    0x35, 0x0D, 0x1C, 0xB0, 0x07, 0xBC, 0xFF, 0xEF, 0xFF, 0x1E, 0x30, 0x07, 0x0C, // Code for char 0xCE
+    0x35, 0x0D, 0x1B, 0xF0, 0x06, 0x8C, 0xFF, 0xE3, 0xFF, 0x1B, 0xF0, 0x06, 0x0C, // Code for char 0xCF
+    0x19, 0x0D, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0xC3, 0x03, 0xF0, 0x00, 0x7C, 0x80, 0x3B, 0x70, 0xFC, 0x0F, 0xFC, 0x00, // Code for char 0xD0
+    0x19, 0x0D, 0xF8, 0x3F, 0xFE, 0x2F, 0x07, 0x8C, 0x03, 0xC1, 0xC1, 0xE0, 0x20, 0x70, 0x0C, 0x38, 0xF9, 0x3F, 0xFE, 0x0F, // Code for char 0xD1
+    0x19, 0x0D, 0xE0, 0x0F, 0xFC, 0x97, 0x83, 0x6F, 0xC0, 0x1E, 0x30, 0x07, 0x8C, 0x01, 0xE3, 0xE0, 0xF0, 0x1F, 0xF8, 0x03, // Code for char 0xD2
+    0x19, 0x0D, 0xE0, 0x0F, 0xFC, 0x87, 0x83, 0x63, 0xC0, 0x1C, 0xB0, 0x07, 0xBC, 0x01, 0xE7, 0xE0, 0xF0, 0x1F, 0xF8, 0x03, // Code for char 0xD3
+    0x19, 0x0D, 0xE0, 0x0F, 0xFC, 0xC7, 0x83, 0x7B, 0xC0, 0x1B, 0xF0, 0x06, 0xEC, 0x01, 0xF3, 0xE0, 0xF0, 0x1F, 0xF8, 0x03, // Code for char 0xD4
+    0x19, 0x0D, 0xE0, 0x0F, 0xFC, 0xA7, 0x83, 0x6F, 0xC0, 0x19, 0xF0, 0x06, 0xAC, 0x01, 0xEF, 0xE0, 0xF1, 0x1F, 0xF8, 0x03, // Code for char 0xD5
+    0x19, 0x0D, 0xE0, 0x0F, 0xFC, 0xB7, 0x83, 0x6F, 0xC0, 0x18, 0x30, 0x06, 0xBC, 0x01, 0xEF, 0xE0, 0xF0, 0x1F, 0xF8, 0x03, // Code for char 0xD6
+    0x27, 0x66, 0xC1, 0xB1, 0x8D, 0xC3, 0xB1, 0x8D, 0x83, // Code for char 0xD7
+    0x19, 0x2B, 0xFC, 0xEB, 0xFF, 0x07, 0x36, 0xF8, 0xE3, 0xBD, 0xC7, 0x1F, 0x6C, 0xE0, 0xFF, 0xD7, 0x3F, // Code for char 0xD8
+    0x19, 0x0D, 0xF8, 0x07, 0xFE, 0x17, 0x80, 0x0F, 0xC0, 0x06, 0x30, 0x01, 0x0C, 0x00, 0x03, 0xE0, 0xF8, 0x1F, 0xFE, 0x01, // Code for char 0xD9
+    0x19, 0x0D, 0xF8, 0x07, 0xFE, 0x07, 0x80, 0x03, 0xC0, 0x04, 0xB0, 0x01, 0x3C, 0x00, 0x07, 0xE0, 0xF8, 0x1F, 0xFE, 0x01, // Code for char 0xDA
+    0x19, 0x0D, 0xF8, 0x07, 0xFE, 0x47, 0x80, 0x1B, 0xC0, 0x03, 0xF0, 0x00, 0x6C, 0x00, 0x13, 0xE0, 0xF8, 0x1F, 0xFE, 0x01, // Code for char 0xDB
+    0x19, 0x0D, 0xF8, 0x07, 0xFE, 0x37, 0x80, 0x0F, 0xC0, 0x00, 0x30, 0x00, 0x3C, 0x00, 0x0F, 0xE0, 0xF8, 0x1F, 0xFE, 0x01, // Code for char 0xDC
+    0x19, 0x0D, 0x08, 0x00, 0x06, 0x00, 0x03, 0x80, 0x01, 0xC4, 0xBF, 0xF1, 0x3F, 0x06, 0xC4, 0x00, 0x18, 0x00, 0x02, 0x00, // Code for char 0xDD
+    0x27, 0x2B, 0x03, 0xFC, 0xFF, 0xFF, 0xBF, 0xD9, 0x98, 0x81, 0x19, 0xF8, 0x01, 0x0F, // Code for char 0xDE
+    0x27, 0x4B, 0xFC, 0xEF, 0xFF, 0x13, 0x12, 0x21, 0x11, 0x32, 0x33, 0xFE, 0xC3, 0x1E, // Code for char 0xDF
+    0x19, 0x1C, 0x00, 0x0E, 0xE4, 0xC3, 0xE6, 0xD8, 0x3C, 0x9B, 0x6D, 0x33, 0x6D, 0x86, 0xCD, 0xF0, 0x1F, 0xFC, 0x03, // Code for char 0xE0
+    0x19, 0x1C, 0x00, 0x0E, 0xE4, 0xC3, 0x66, 0xDA, 0x6C, 0x9B, 0x67, 0x73, 0x6C, 0x86, 0xCD, 0xF0, 0x1F, 0xFC, 0x03, // Code for char 0xE1
+    0x19, 0x1C, 0x00, 0x0E, 0xE4, 0xD3, 0x66, 0xDB, 0x3C, 0x9B, 0x67, 0xB3, 0x6D, 0xA6, 0xCD, 0xF0, 0x1F, 0xFC, 0x03, // Code for char 0xE2
+    0x19, 0x2B, 0x00, 0x07, 0xF9, 0xDA, 0xBC, 0xCD, 0xD9, 0xBC, 0xCD, 0xDA, 0xBC, 0xCD, 0xF9, 0x0F, 0xFF, // Code for char 0xE3
+    0x19, 0x2B, 0x00, 0x07, 0xF9, 0xDB, 0xBC, 0xCD, 0xD8, 0x8C, 0xCD, 0xDB, 0xBC, 0xCD, 0xF8, 0x0F, 0xFF, // Code for char 0xE4
+    0x19, 0x1C, 0x00, 0x0E, 0xE4, 0xC3, 0x66, 0xD8, 0x7C, 0x9B, 0x6B, 0xF3, 0x6D, 0x86, 0xCD, 0xF0, 0x1F, 0xFC, 0x03, // Code for char 0xE5
+    0x19, 0x58, 0xE0, 0xE4, 0x6F, 0xDE, 0xFC, 0xDF, 0xDF, 0xE6, 0xCD, 0x8F, 0x0D, 0x01, // Code for char 0xE6
+    0x19, 0x5A, 0x7C, 0xF0, 0xC7, 0x71, 0x06, 0x33, 0xD8, 0xC1, 0x0F, 0x7E, 0x30, 0xC6, 0x20, 0x02, // Code for char 0xE7
+    0x19, 0x1C, 0xC0, 0x07, 0xFC, 0xC1, 0xF7, 0xD8, 0x3C, 0x9B, 0x6D, 0x33, 0x6D, 0x86, 0xCD, 0xE0, 0x09, 0x18, 0x00, // Code for char 0xE8
+    0x19, 0x1C, 0xC0, 0x07, 0xFC, 0xC1, 0x77, 0xDA, 0x6C, 0x9B, 0x67, 0x73, 0x6C, 0x86, 0xCD, 0xE0, 0x09, 0x18, 0x00, // Code for char 0xE9
+    0x19, 0x1C, 0xC0, 0x07, 0xFC, 0xD1, 0x77, 0xDB, 0x3C, 0x9B, 0x67, 0xB3, 0x6D, 0xA6, 0xCD, 0xE0, 0x09, 0x18, 0x00, // Code for char 0xEA
+    0x19, 0x1C, 0xC0, 0x07, 0xFC, 0xCD, 0xF7, 0xD9, 0x0C, 0x9B, 0x61, 0xF3, 0x6C, 0x9E, 0xCD, 0xE0, 0x09, 0x18, 0x00, // Code for char 0xEB
+    0x35, 0x1C, 0x00, 0x38, 0x06, 0xCF, 0x7F, 0xFB, 0x4F, 0x80, 0x01, 0x30, // Code for char 0xEC
+    0x35, 0x1C, 0x00, 0x98, 0x06, 0xDB, 0xFF, 0xF9, 0x1F, 0x80, 0x01, 0x30, // Code for char 0xED
+    0x35, 0x1C, 0x04, 0xD8, 0x06, 0xCF, 0xFF, 0xF9, 0x6F, 0x80, 0x09, 0x30, // Code for char 0xEE
+    0x35, 0x1C, 0x03, 0x78, 0x06, 0xC3, 0x7F, 0xF8, 0x3F, 0x80, 0x07, 0x30, // Code for char 0xEF
+    0x19, 0x1C, 0xC0, 0x07, 0xFC, 0xC1, 0xF1, 0x1A, 0x7C, 0x83, 0x65, 0xF0, 0x0D, 0xEE, 0xE3, 0xE8, 0x0F, 0xF8, 0x00, // Code for char 0xF0
+    0x28, 0x2B, 0xF8, 0xAF, 0xFF, 0x1B, 0x90, 0x01, 0x1B, 0xA0, 0x01, 0x3B, 0x10, 0xFF, 0xE0, 0x0F, // Code for char 0xF1
+    0x19, 0x1C, 0xC0, 0x07, 0xFC, 0xC1, 0xF1, 0x18, 0x3C, 0x83, 0x6D, 0x30, 0x0D, 0x86, 0xE3, 0xE0, 0x0F, 0xF8, 0x00, // Code for char 0xF2
+    0x19, 0x1C, 0xC0, 0x07, 0xFC, 0xC1, 0x71, 0x1A, 0x6C, 0x83, 0x67, 0x70, 0x0C, 0x86, 0xE3, 0xE0, 0x0F, 0xF8, 0x00, // Code for char 0xF3
+    0x19, 0x1C, 0xC0, 0x07, 0xFC, 0xD1, 0x71, 0x1B, 0x3C, 0x83, 0x67, 0xB0, 0x0D, 0xA6, 0xE3, 0xE0, 0x0F, 0xF8, 0x00, // Code for char 0xF4
+    0x19, 0x2B, 0xE0, 0x03, 0x7F, 0x3A, 0xBE, 0xC1, 0x19, 0xBC, 0xC1, 0x1A, 0xBC, 0xE3, 0xF1, 0x07, 0x3E, // Code for char 0xF5
+    0x19, 0x1C, 0xC0, 0x07, 0xFC, 0xCD, 0xF1, 0x19, 0x0C, 0x83, 0x61, 0xF0, 0x0C, 0x9E, 0xE3, 0xE0, 0x0F, 0xF8, 0x00, // Code for char 0xF6
+    0x27, 0x47, 0x18, 0x18, 0x18, 0xDB, 0xDB, 0x18, 0x18, 0x18, // Code for char 0xF7
+    0x28, 0x58, 0x7C, 0xFD, 0x1D, 0x1F, 0x3D, 0x79, 0xF1, 0x71, 0x7F, 0x7D, 0x00, // Code for char 0xF8
+    0x19, 0x1C, 0xF0, 0x07, 0xFE, 0x01, 0xF0, 0x00, 0x3C, 0x80, 0x0D, 0x30, 0x01, 0x06, 0x60, 0xF0, 0x1F, 0xFE, 0x03, // Code for char 0xF9
+    0x19, 0x1C, 0xF0, 0x07, 0xFE, 0x01, 0x70, 0x02, 0x6C, 0x80, 0x07, 0x70, 0x00, 0x06, 0x60, 0xF0, 0x1F, 0xFE, 0x03, // Code for char 0xFA
+    0x19, 0x1C, 0xF0, 0x07, 0xFE, 0x11, 0x70, 0x03, 0x3C, 0x80, 0x07, 0xB0, 0x01, 0x26, 0x60, 0xF0, 0x1F, 0xFE, 0x03, // Code for char 0xFB
+    0x19, 0x2B, 0xF8, 0x83, 0x7F, 0x03, 0x3E, 0xC0, 0x00, 0x0C, 0xC0, 0x03, 0x3C, 0x60, 0xF8, 0x8F, 0xFF, // Code for char 0xFC
+    0x27, 0x2D, 0x18, 0x00, 0x1E, 0x08, 0x9E, 0x13, 0x7E, 0x86, 0xC7, 0x78, 0x90, 0x07, 0x60, 0x00, // Code for char 0xFD
+    0x27, 0x0D, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0x6F, 0xD8, 0x18, 0x06, 0x86, 0x81, 0x7F, 0xC0, 0x0F, // Code for char 0xFE
+    0x27, 0x2D, 0x18, 0xC0, 0x1E, 0x38, 0x9E, 0x03, 0x7E, 0x80, 0xC7, 0x78, 0xB0, 0x07, 0x60, 0x00 // Code for char 0xFF
+};
+
+///
+/// @brief Offsets of characters 32, 48, 64... in Terminal12x16p
+///
+static const uint16_t Terminal12x16pIndex[14] =
+{
+    0, 168, 456, 771, 1049, 1280, 1490, 1668, 1794, 1972, 2131, 2425, 2719, 2983
+};
+
+#endif // TERMINAL12P_FONT_RELEASE
@@ -0,0 +1,285 @@
+///
+/// @file Terminal16x24p.h
+/// @brief Font Terminal 16 x 24, packed
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 16 Oct 2026
+/// @version 523
+///
+/// @copyright (c) Rei Vilo, 2010-2023
+/// @copyright All rights reserved
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+
+//
+// Terminal16x24p.h
+// Font library
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+
+#ifndef TERMINAL16P_FONT_RELEASE
+///
+/// @brief Release
+///
+#define TERMINAL16P_FONT_RELEASE 523
+
+///
+/// @brief Font Terminal16x24, packed
+/// @details Same glyphs as Terminal16x24e.h, 4414 bytes instead of 10752
+/// @n Per character
+/// * 1 byte, first column << 4 | (number of columns - 1), 0xff = blank
+/// * 1 byte, first row
+/// * 1 byte, number of rows
+/// * bitstream, columns of rows, first bit on LSB
+///
+static const uint8_t Terminal16x24p[4414] =
+{
+    0xFF, // Code for char space
+    0x72, 0x02, 0x11, 0xFF, 0xCF, 0xFF, 0x9F, 0x03, 0x00, 0x07, // Code for char !
+    0x57, 0x02, 0x06, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, // Code for char "
+    0x3B, 0x04, 0x0F, 0x00, 0x06, 0x18, 0x03, 0x8C, 0x1F, 0xFE, 0xFF, 0x7F, 0xF8, 0x31, 0xC0, 0xF8, 0xE1, 0xFF, 0xFF, 0x87, 0x1F, 0x03, 0x8C, 0x01, 0x06, 0x00, // Code for char #
+    0x39, 0x01, 0x15, 0xF0, 0x80, 0x01, 0x3F, 0x60, 0x60, 0x0E, 0x0C, 0x86, 0xC1, 0xCF, 0xF8, 0xFF, 0xFF, 0x3F, 0xC6, 0x83, 0xC3, 0x60, 0x60, 0x0C, 0x0C, 0xF8, 0x01, 0x00, 0x1E, 0x00, // Code for char $
+    0x2C, 0x02, 0x11, 0x3C, 0x00, 0xFD, 0x00, 0x8F, 0x81, 0x1B, 0x83, 0x33, 0xC6, 0xE1, 0xE7, 0x80, 0xE7, 0x3C, 0x70, 0xFC, 0x70, 0x8C, 0x39, 0x18, 0x3B, 0x30, 0x1E, 0xE0, 0x17, 0x80, 0x07, // Code for char %
+    0x3B, 0x02, 0x11, 0x00, 0x7C, 0x78, 0xFC, 0xF9, 0x1F, 0x3F, 0x1E, 0x3C, 0x78, 0x78, 0xD8, 0xF1, 0x39, 0x77, 0x3F, 0x7C, 0x3C, 0xF0, 0x00, 0xFC, 0x03, 0x38, 0x06, 0x00, 0x08, // Code for char &
+    0x72, 0x02, 0x06, 0xFF, 0xFF, 0x03, // Code for char '
+    0x66, 0x02, 0x16, 0x00, 0x7F, 0x00, 0xF8, 0x7F, 0x00, 0x0F, 0x7C, 0x70, 0x00, 0x38, 0x0E, 0x00, 0xDC, 0x01, 0x00, 0x2E, 0x00, 0x00, 0x01, // Code for char (
+    0x56, 0x02, 0x16, 0x02, 0x00, 0xD0, 0x01, 0x00, 0xEE, 0x00, 0xC0, 0x71, 0x00, 0x38, 0xF8, 0xC0, 0x03, 0xF8, 0x7F, 0x00, 0xF8, 0x03, 0x00, // Code for char )
+    0x49, 0x02, 0x0A, 0xC8, 0x30, 0x83, 0x04, 0x0C, 0xFF, 0xFF, 0x0F, 0x03, 0x12, 0xCC, 0x20, 0x01, // Code for char *
+    0x3B, 0x06, 0x0C, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0xF0, 0xFF, 0xFF, 0x0F, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, // Code for char +
+    0x55, 0x0F, 0x08, 0xC0, 0xC0, 0xE7, 0x7F, 0x3F, 0x1E, // Code for char ,
+    0x56, 0x0C, 0x02, 0xFF, 0x3F, // Code for char -
+    0x73, 0x0F, 0x04, 0xF6, 0x6F, // Code for char .
+    0x39, 0x02, 0x14, 0x00, 0x00, 0x08, 0x00, 0xF0, 0x00, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x00, // Code for char /
+    0x3A, 0x04, 0x0F, 0xF0, 0x07, 0xFE, 0x8F, 0x83, 0xEF, 0x60, 0x3E, 0x18, 0x1E, 0x0E, 0x0F, 0x83, 0xCF, 0xE0, 0x3E, 0x38, 0xFE, 0x0F, 0xFC, 0x01, // Code for char 0
+    0x49, 0x04, 0x0F, 0x04, 0x60, 0x07, 0xB0, 0x01, 0x78, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x30, // Code for char 1
+    0x49, 0x04, 0x0F, 0x04, 0x60, 0x07, 0xF8, 0x01, 0x7E, 0x80, 0x3D, 0x60, 0x1E, 0x18, 0x1F, 0x87, 0xFD, 0xC1, 0x7C, 0x60, 0x00, 0x30, // Code for char 2
+    0x48, 0x04, 0x0F, 0x06, 0xE0, 0x01, 0xF0, 0x30, 0x78, 0x18, 0x3C, 0x0C, 0x3E, 0x07, 0xFB, 0xC6, 0x38, 0x7F, 0x00, 0x0F, // Code for char 3
+    0x3B, 0x04, 0x0F, 0x00, 0x0E, 0x80, 0x07, 0x70, 0x03, 0x9E, 0x81, 0xC3, 0x70, 0x60, 0x1C, 0x30, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x06, 0x00, 0x03, 0x80, 0x01, // Code for char 4
+    0x48, 0x04, 0x0F, 0xFF, 0xE0, 0x7F, 0xF0, 0x30, 0x78, 0x18, 0x3C, 0x0C, 0x1E, 0x06, 0x0F, 0xC7, 0x06, 0x3F, 0x00, 0x0F, // Code for char 5
+    0x39, 0x04, 0x0F, 0xE0, 0x0F, 0xFC, 0x1F, 0x63, 0xCC, 0x18, 0x7C, 0x0C, 0x1E, 0x06, 0x0F, 0x83, 0x87, 0x63, 0x83, 0x3F, 0x80, 0x07, // Code for char 6
+    0x39, 0x04, 0x0F, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x78, 0x00, 0x3F, 0xE0, 0x1B, 0x3C, 0x8C, 0x07, 0xF6, 0x00, 0x1F, 0x80, 0x03, 0x00, // Code for char 7
+    0x39, 0x04, 0x0F, 0x1C, 0x1E, 0x9F, 0xDF, 0xF9, 0x7C, 0x3C, 0x3C, 0x0C, 0x1E, 0x06, 0x8F, 0x87, 0xCF, 0xE7, 0x3E, 0x3F, 0x0E, 0x0F, // Code for char 8
+    0x39, 0x04, 0x0F, 0x78, 0x00, 0x7F, 0xB0, 0x71, 0x78, 0x30, 0x3C, 0x18, 0x1E, 0x8C, 0x0F, 0xC6, 0x8C, 0x39, 0xFE, 0x0F, 0xFC, 0x01, // Code for char 9
+    0x72, 0x07, 0x0C, 0x06, 0xF6, 0xF0, 0x06, 0x06, // Code for char :
+    0x55, 0x07, 0x10, 0x00, 0xC0, 0x00, 0xC0, 0x06, 0xE7, 0x0F, 0x7F, 0x06, 0x3F, 0x00, 0x1E, // Code for char ;
+    0x48, 0x06, 0x0D, 0x40, 0x00, 0x1C, 0xC0, 0x07, 0xD8, 0x80, 0x31, 0x18, 0x8C, 0x01, 0x3B, 0xE0, 0x02, 0x08, // Code for char <
+    0x49, 0x09, 0x06, 0xF3, 0x3C, 0xCF, 0xF3, 0x3C, 0xCF, 0xF3, 0x0C, // Code for char =
+    0x48, 0x06, 0x0D, 0x02, 0xE8, 0x80, 0x1B, 0x30, 0x06, 0x83, 0x31, 0x60, 0x03, 0x7C, 0x00, 0x07, 0x40, 0x00, // Code for char >
+    0x66, 0x02, 0x11, 0x03, 0x00, 0x06, 0x80, 0x0F, 0x3C, 0x37, 0x78, 0xEE, 0x38, 0x80, 0x7F, 0x00, 0x3E, 0x00, // Code for char ?
+    0x2C, 0x02, 0x16, 0x00, 0xFF, 0x01, 0xF8, 0xFF, 0x83, 0x0F, 0xE0, 0x71, 0x00, 0x40, 0x06, 0xFE, 0xF0, 0xE0, 0x7F, 0x18, 0x1C, 0x18, 0x06, 0xE3, 0x83, 0xC1, 0xFF, 0xE1, 0xF0, 0x60, 0xE4, 0x00, 0x1C, 0xF0, 0xFF, 0x03, 0xF0, 0x3F, 0x00, // Code for char @
+    0x3B, 0x04, 0x0F, 0x00, 0x70, 0x00, 0x3F, 0xF8, 0x83, 0x9F, 0xF1, 0xC1, 0x08, 0x60, 0x3C, 0x30, 0xFC, 0x18, 0xF0, 0x0F, 0xC0, 0x0F, 0x00, 0x1F, 0x00, 0x0E, // Code for char A
+    0x49, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x78, 0x18, 0x3C, 0x0C, 0x1E, 0x06, 0x9F, 0x83, 0x7D, 0x63, 0x9C, 0x3F, 0x00, 0x07, // Code for char B
+    0x39, 0x04, 0x0F, 0xF0, 0x07, 0xFE, 0x8F, 0x07, 0xCF, 0x00, 0x36, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0x60, 0x03, 0x18, // Code for char C
+    0x3A, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0xC0, 0x0D, 0x60, 0x0E, 0x3C, 0xFE, 0x0F, 0xFC, 0x01, // Code for char D
+    0x48, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x78, 0x18, 0x3C, 0x0C, 0x1E, 0x06, 0x0F, 0x83, 0x87, 0xC1, 0xC3, 0x60, // Code for char E
+    0x48, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x60, 0x18, 0x30, 0x0C, 0x18, 0x06, 0x0C, 0x03, 0x86, 0x01, 0xC3, 0x00, // Code for char F
+    0x3A, 0x04, 0x0F, 0xE0, 0x07, 0xFC, 0x0F, 0x07, 0xCF, 0x00, 0x76, 0x00, 0x1E, 0x00, 0x0F, 0x83, 0x87, 0xC1, 0xC3, 0xE0, 0xE1, 0xBF, 0xF1, 0x0F, // Code for char G
+    0x3A, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, // Code for char H
+    0x49, 0x04, 0x0F, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0x30, // Code for char I
+    0x47, 0x04, 0x0F, 0x03, 0xB0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x80, 0xFF, 0xFF, 0xFE, 0x3F, // Code for char J
+    0x49, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0x20, 0x00, 0x38, 0x00, 0x77, 0xC0, 0x71, 0x70, 0x70, 0x0C, 0x70, 0x03, 0xE0, 0x00, 0x20, // Code for char K
+    0x58, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x60, // Code for char L
+    0x3B, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x18, 0x80, 0x07, 0xF0, 0x00, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x0C, // Code for char M
+    0x3A, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x1F, // Code for char N
+    0x3B, 0x04, 0x0F, 0xF0, 0x07, 0xFE, 0x8F, 0x03, 0xCE, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x07, 0x30, 0x07, 0x1C, 0xFF, 0x07, 0xFE, 0x00, // Code for char O
+    0x49, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x03, 0xFE, 0x00, 0x3C, 0x00, // Code for char P
+    0x3B, 0x04, 0x13, 0xF0, 0x07, 0xE0, 0xFF, 0x80, 0x03, 0x0E, 0x0C, 0xE0, 0x30, 0x00, 0x86, 0x01, 0xF0, 0x0C, 0x80, 0x6F, 0x00, 0xEC, 0x07, 0x30, 0x76, 0xC0, 0x31, 0xFF, 0x87, 0xE1, 0x0F, 0x06, // Code for char Q
+    0x49, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x3C, 0x1C, 0x7B, 0xFC, 0xF9, 0x3C, 0x70, 0x00, 0x20, // Code for char R
+    0x39, 0x04, 0x0F, 0x3C, 0x30, 0x3F, 0xB0, 0x19, 0x78, 0x18, 0x3C, 0x0C, 0x1E, 0x0C, 0x0F, 0x86, 0x07, 0x67, 0x06, 0x3F, 0x00, 0x0F, // Code for char S
+    0x3B, 0x04, 0x0F, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x00, // Code for char T
+    0x3A, 0x04, 0x0F, 0xFF, 0x9F, 0xFF, 0x1F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xB0, 0xFF, 0xDF, 0xFF, 0x03, // Code for char U
+    0x2C, 0x04, 0x0F, 0x07, 0x80, 0x0F, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xF8, 0x03, 0xE0, 0x03, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0xF0, 0x03, 0x3F, 0xE0, 0x03, 0x70, 0x00, 0x00, // Code for char V
+    0x3A, 0x04, 0x0F, 0xFF, 0x83, 0xFF, 0x3F, 0x00, 0x1F, 0x00, 0x0F, 0xF8, 0x01, 0x03, 0x00, 0x7F, 0x00, 0xF8, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, // Code for char W
+    0x2C, 0x04, 0x0F, 0x00, 0xC0, 0x00, 0xF0, 0x00, 0xFE, 0x81, 0xC7, 0xE3, 0xC0, 0x3F, 0x80, 0x07, 0xE0, 0x07, 0x38, 0x0F, 0x0E, 0xDF, 0x03, 0x7E, 0x00, 0x1C, 0x00, 0x04, // Code for char X
+    0x2C, 0x04, 0x0F, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0xFC, 0x03, 0xFE, 0x81, 0x03, 0xF0, 0x00, 0x1E, 0x80, 0x03, 0xE0, 0x00, 0x10, 0x00, 0x00, // Code for char Y
+    0x3A, 0x04, 0x0F, 0x03, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0xE0, 0x3D, 0x38, 0x1E, 0x07, 0xEF, 0x81, 0x3F, 0xC0, 0x0F, 0xE0, 0x01, 0x30, 0x00, 0x18, // Code for char Z
+    0x65, 0x02, 0x16, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0x03, 0x00, 0xF0, 0x00, 0x00, 0x0C, // Code for char [
+    0x49, 0x02, 0x14, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0xC0, 0x07, 0x00, 0xE0, 0x03, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x80, // Code for char 0x5C
+    0x55, 0x02, 0x16, 0x03, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, // Code for char ]
+    0x48, 0x04, 0x07, 0x60, 0x38, 0xE7, 0x30, 0x38, 0x70, 0xE0, 0x60, // Code for char ^
+    0x2C, 0x16, 0x02, 0xFF, 0xFF, 0xFF, 0x03, // Code for char _
+    0x54, 0x02, 0x03, 0xD9, 0x4D, // Code for char `
+    0x49, 0x07, 0x0C, 0x80, 0x67, 0x7C, 0xE3, 0x3C, 0xC6, 0x63, 0x3C, 0xC6, 0x63, 0x7E, 0x66, 0xFE, 0xCF, 0xFF, // Code for char a
+    0x49, 0x02, 0x11, 0xFF, 0xFF, 0xFE, 0xFF, 0x03, 0x07, 0x06, 0x06, 0x0C, 0x06, 0x18, 0x0C, 0x30, 0x18, 0x70, 0x70, 0x70, 0xC0, 0x7F, 0x00, 0x7E, 0x00, // Code for char b
+    0x48, 0x07, 0x0C, 0xF8, 0xC1, 0x7F, 0x0E, 0x77, 0xE0, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xC0, 0x06, 0x06, // Code for char c
+    0x39, 0x02, 0x11, 0x00, 0x3F, 0x00, 0xFF, 0x01, 0x07, 0x07, 0x07, 0x0C, 0x06, 0x18, 0x0C, 0x30, 0x18, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, // Code for char d
+    0x39, 0x07, 0x0C, 0xF8, 0xC1, 0x7F, 0x66, 0x36, 0xC6, 0x63, 0x3C, 0xC6, 0x63, 0x6C, 0xC6, 0x7E, 0x86, 0x07, // Code for char e
+    0x3A, 0x02, 0x11, 0xC0, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x06, 0xC0, 0xFF, 0xDF, 0xFF, 0xFF, 0x31, 0x80, 0x61, 0x00, 0xC3, 0x00, 0x86, 0x01, 0x0C, 0x00, 0x00, // Code for char f
+    0x3A, 0x07, 0x11, 0x00, 0x73, 0x78, 0xFF, 0xF9, 0x33, 0x3F, 0x67, 0x3C, 0xCC, 0x78, 0x98, 0xF1, 0x30, 0xE3, 0x73, 0xC6, 0x7F, 0xCC, 0x7E, 0xF0, 0x0D, 0xE0, 0x01, // Code for char g
+    0x48, 0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x38, 0x00, 0xE0, 0xFF, 0x80, 0xFF, 0x01, // Code for char h
+    0x48, 0x02, 0x11, 0x60, 0x80, 0xC1, 0x00, 0x83, 0x01, 0x3E, 0x03, 0x7C, 0xFE, 0xFF, 0xFC, 0x3F, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x80, 0x01, // Code for char i
+    0x47, 0x02, 0x16, 0x60, 0x00, 0x18, 0x18, 0x00, 0x0C, 0x06, 0x00, 0x83, 0x01, 0xC0, 0x60, 0x00, 0xF0, 0x19, 0x00, 0x7E, 0xFE, 0xFF, 0x9D, 0xFF, 0x1F, // Code for char j
+    0x49, 0x02, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x10, 0x00, 0x70, 0x00, 0xB0, 0x01, 0x30, 0x06, 0x70, 0x18, 0x70, 0x60, 0x60, 0x80, 0x41, 0x00, 0x02, // Code for char k
+    0x48, 0x02, 0x11, 0x03, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x80, 0x01, // Code for char l
+    0x3B, 0x07, 0x0C, 0xFF, 0xFF, 0xFF, 0x0E, 0x30, 0x00, 0x03, 0xF0, 0xFF, 0xFE, 0xEF, 0x00, 0x03, 0x30, 0x00, 0xFF, 0xEF, 0xFF, // Code for char m
+    0x48, 0x07, 0x0C, 0xFF, 0xFF, 0xFF, 0x0E, 0x60, 0x00, 0x03, 0x30, 0x00, 0x07, 0xE0, 0xFF, 0xFC, 0x0F, // Code for char n
+    0x3A, 0x07, 0x0C, 0xF8, 0xC1, 0x7F, 0x0E, 0x77, 0xE0, 0x03, 0x3C, 0xC0, 0x03, 0x7C, 0xE0, 0x0E, 0xE7, 0x3F, 0xF8, 0x01, // Code for char o
+    0x49, 0x07, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x30, 0x30, 0x60, 0x30, 0xC0, 0x60, 0x80, 0xC1, 0x80, 0x83, 0x83, 0x03, 0xFE, 0x03, 0xF0, 0x03, 0x00, // Code for char p
+    0x39, 0x07, 0x11, 0xF8, 0x01, 0xF8, 0x0F, 0x38, 0x38, 0x38, 0x60, 0x30, 0xC0, 0x60, 0x80, 0xC1, 0x80, 0x81, 0x81, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, // Code for char q
+    0x49, 0x07, 0x0C, 0xFF, 0xFF, 0xFF, 0x0C, 0x60, 0x00, 0x03, 0x30, 0x00, 0x03, 0x70, 0x00, 0x1E, 0xC0, 0x01, // Code for char r
+    0x48, 0x07, 0x0C, 0x1C, 0xE6, 0xC3, 0x33, 0x3C, 0xC6, 0x63, 0x3C, 0xC6, 0xC3, 0x6C, 0x7C, 0x80, 0x03, // Code for char s
+    0x3A, 0x03, 0x10, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFE, 0x1F, 0xFF, 0x7F, 0x30, 0xF0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, 0x30, 0xC0, // Code for char t
+    0x48, 0x07, 0x0C, 0xFF, 0xF3, 0x7F, 0x00, 0x0E, 0xC0, 0x00, 0x0C, 0x60, 0x00, 0xF7, 0xFF, 0xFF, 0x0F, // Code for char u
+    0x3A, 0x07, 0x0C, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x3E, 0x7C, 0xF0, 0x01, 0x03, 0x00, // Code for char v
+    0x3A, 0x07, 0x0C, 0xFF, 0xF0, 0xFF, 0x00, 0x0C, 0xF8, 0xF0, 0x81, 0x01, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0xFF, 0x7F, 0x00, // Code for char w
+    0x3A, 0x07, 0x0C, 0x01, 0x38, 0xC0, 0x0F, 0xEF, 0x79, 0xF8, 0x01, 0x07, 0xF8, 0xC1, 0x79, 0x0F, 0x3F, 0xC0, 0x01, 0x08, // Code for char x
+    0x2B, 0x07, 0x11, 0x00, 0x80, 0x0F, 0x00, 0x7F, 0x00, 0xE6, 0x07, 0x0E, 0x3E, 0x0E, 0xF0, 0x0F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x18, 0x00, 0x00, // Code for char y
+    0x48, 0x07, 0x0C, 0x03, 0x3C, 0xE0, 0x83, 0x3F, 0xDC, 0x63, 0xBC, 0xC3, 0x1F, 0x7C, 0xC0, 0x03, 0x0C, // Code for char z
+    0x47, 0x02, 0x16, 0x00, 0x06, 0x00, 0x80, 0x01, 0x00, 0xF0, 0x00, 0xF0, 0xFF, 0x3F, 0xFE, 0xF9, 0xDF, 0x01, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x00, 0xC0, // Code for char {
+    0x81, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // Code for char |
+    0x57, 0x02, 0x16, 0x03, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x80, 0xFB, 0xE7, 0x7F, 0xFC, 0xFF, 0x0F, 0xC0, 0x03, 0x00, 0x60, 0x00, 0x00, 0x18, 0x00, // Code for char }
+    0x3B, 0x0A, 0x05, 0xCC, 0x8D, 0x31, 0x0C, 0xC3, 0x18, 0x3B, 0x03, // Code for char ~
+    0x24, 0x04, 0x0E, 0xFF, 0x7F, 0x00, 0x18, 0x00, 0x06, 0x80, 0xFF, 0x3F, // Code for char 0x7F
+    0x2A, 0x04, 0x0F, 0xA0, 0x00, 0xF8, 0x03, 0xFF, 0xC7, 0x97, 0x67, 0x0A, 0x1B, 0x05, 0x8F, 0x82, 0x47, 0xC1, 0x27, 0xE0, 0x03, 0xB8, 0x00, 0x0C, // Code for char 0x80
+    0xFF, // Code for char 0x81
+    0xFF, // Code for char 0x82
+    0xFF, // Code for char 0x83
+    0xFF, // Code for char 0x84
+    0xFF, // Code for char 0x85
+    0xFF, // Code for char 0x86
+    0xFF, // Code for char 0x87
+    0xFF, // Code for char 0x88
+    0x1E, 0x02, 0x11, 0x00, 0x00, 0x19, 0x00, 0x4B, 0x80, 0x93, 0x80, 0xC3, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x18, 0x70, 0x48, 0x70, 0x90, 0x38, 0xC0, 0x38, 0x00, 0x18, 0x00, 0x13, 0x00, 0x09, 0x00, 0x12, 0x00, 0x18, // Code for char 0x89
+    0xFF, // Code for char 0x8A
+    0xFF, // Code for char 0x8B
+    0x3B, 0x04, 0x0F, 0xF0, 0x07, 0xFE, 0x8F, 0x03, 0xCE, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xE0, 0x61, 0xF0, 0x30, 0x78, 0x18, 0x0C, // Code for char 0x8C
+    0xFF, // Code for char 0x8D
+    0xFF, // Code for char 0x8E
+    0xFF, // Code for char 0x8F
+    0xFF, // Code for char 0x90
+    0xFF, // Code for char 0x91
+    0xFF, // Code for char 0x92
+    0xFF, // Code for char 0x93
+    0xFF, // Code for char 0x94
+    0xFF, // Code for char 0x95
+    0xFF, // Code for char 0x96
+    0xFF, // Code for char 0x97
+    0xFF, // Code for char 0x98
+    0x3A, 0x04, 0x06, 0x41, 0xF0, 0x07, 0x01, 0xF0, 0x0B, 0x84, 0xF0, 0x03, // Code for char 0x99
+    0xFF, // Code for char 0x9A
+    0xFF, // Code for char 0x9B
+    0x2B, 0x07, 0x0C, 0xFC, 0xE3, 0x7F, 0x03, 0x3C, 0xC0, 0x06, 0xC6, 0x3F, 0xFE, 0x77, 0xE6, 0x63, 0x3C, 0xC6, 0x7E, 0xCC, 0xC7, // Code for char 0x9C
+    0xFF, // Code for char 0x9D
+    0xFF, // Code for char 0x9E
+    0x2C, 0x00, 0x13, 0x70, 0x00, 0x00, 0x07, 0x00, 0xF0, 0x00, 0x06, 0x1E, 0x30, 0xE0, 0x01, 0x00, 0xFC, 0x03, 0xE0, 0x1F, 0x80, 0x03, 0x03, 0x0F, 0x18, 0x1E, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x00, 0x01, 0x00, // Code for char 0x9F
+    0xFF, // Code for char 0xA0
+    0x72, 0x07, 0x11, 0xE7, 0xFF, 0xCF, 0xFF, 0x1F, 0x00, 0x00, // Code for char 0xA1
+    0x38, 0x01, 0x15, 0x80, 0x1F, 0x00, 0xF8, 0x0F, 0x80, 0x83, 0x01, 0x38, 0x60, 0x0E, 0x83, 0xFF, 0xE1, 0xFF, 0xC1, 0xFF, 0x30, 0xB8, 0x01, 0x06, 0x60, 0x60, 0x00, // Code for char 0xA2
+    0x3A, 0x04, 0x0F, 0xC0, 0x60, 0x60, 0x30, 0xFF, 0xDF, 0xFF, 0x7F, 0x0C, 0x1E, 0x06, 0x0F, 0x83, 0x87, 0xC1, 0xC3, 0x60, 0x03, 0xB0, 0x00, 0x18, // Code for char 0xA3
+    0x3A, 0x04, 0x0E, 0x02, 0xD0, 0xF9, 0xEE, 0xFF, 0x71, 0x38, 0x0C, 0x0C, 0x03, 0xC3, 0xC0, 0x70, 0x38, 0xFE, 0xDF, 0x7D, 0x2E, 0x00, 0x01, // Code for char 0xA4
+    0x2B, 0x04, 0x0F, 0x01, 0x80, 0xC1, 0x8C, 0x61, 0x86, 0x33, 0x83, 0x9B, 0x01, 0xFF, 0x83, 0xFF, 0x71, 0x33, 0x9C, 0x19, 0xC3, 0xCC, 0x60, 0x26, 0x00, 0x00, // Code for char 0xA5
+    0x81, 0x00, 0x18, 0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0xFF, // Code for char 0xA6
+    0x49, 0x02, 0x14, 0x80, 0x07, 0xC6, 0xFD, 0xC0, 0xFE, 0x1C, 0x7C, 0x87, 0xC1, 0x63, 0x30, 0x3C, 0x0C, 0xC6, 0xC3, 0x61, 0x36, 0x38, 0x7F, 0x03, 0xBF, 0x03, 0xE0, 0x01, // Code for char 0xA7
+    0x57, 0x02, 0x03, 0xFF, 0x81, 0xFF, // Code for char 0xA8
+    0x2C, 0x04, 0x0F, 0xF0, 0x07, 0xFE, 0x8F, 0x03, 0x4E, 0x00, 0x34, 0x3E, 0x8E, 0x7F, 0x66, 0x30, 0x13, 0x90, 0x0B, 0x68, 0x01, 0x90, 0x03, 0x8E, 0xFF, 0x03, 0x7F, 0x00, // Code for char 0xA9
+    0x57, 0x04, 0x0A, 0x70, 0xEE, 0x9B, 0x68, 0xA2, 0x49, 0xFE, 0xEB, 0x2F, 0x80, // Code for char 0xAA
+    0x39, 0x08, 0x09, 0x10, 0xF8, 0xB8, 0x3B, 0x0E, 0x00, 0x00, 0x04, 0x3E, 0xEE, 0x8E, 0x03, // Code for char 0xAB
+    0x39, 0x0B, 0x05, 0x63, 0x8C, 0x31, 0xC6, 0x18, 0xFF, 0x03, // Code for char 0xAC
+    0x56, 0x0C, 0x02, 0xFF, 0x3F, // Code for char 0xAD
+    0x48, 0x02, 0x0B, 0xF8, 0x30, 0x98, 0x80, 0xFA, 0x5B, 0xC2, 0x6E, 0x0A, 0xCC, 0x60, 0xF8, 0x00, // Code for char 0xAE
+    0x65, 0x02, 0x02, 0xFF, 0x0F, // Code for char 0xAF
+    0x47, 0x02, 0x08, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, // Code for char 0xB0
+    0x49, 0x05, 0x0E, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0xC3, 0xC0, 0xFF, 0xF3, 0xFF, 0x0C, 0x03, 0xC3, 0xC0, 0x30, 0x30, 0x0C, 0x0C, // Code for char 0xB1
+    0x56, 0x02, 0x0A, 0x02, 0x0F, 0x3E, 0xFC, 0xF8, 0x3F, 0x7B, 0x0C, 0x30, // Code for char 0xB2
+    0x56, 0x02, 0x0A, 0x03, 0xCF, 0x3C, 0xF3, 0xCC, 0x33, 0xFF, 0xE7, 0x1E, // Code for char 0xB3
+    0x74, 0x02, 0x03, 0xF4, 0x17, // Code for char 0xB4
+    0x49, 0x07, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x38, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0xC0, 0x81, 0xFF, 0x03, 0xFF, 0x0F, 0x00, 0x18, 0x00, // Code for char 0xB5
+    0x39, 0x02, 0x14, 0x78, 0x00, 0xE0, 0x1F, 0x40, 0xFE, 0x01, 0xF6, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0x00, 0x3C, 0x00, 0x60, 0xFF, 0xFF, 0xF7, 0xFF, 0x1F, // Code for char 0xB6
+    0x73, 0x0A, 0x04, 0xF6, 0x6F, // Code for char 0xB7
+    0x72, 0x13, 0x03, 0xFE, 0x00, // Code for char 0xB8
+    0x56, 0x02, 0x0A, 0x0C, 0x1B, 0x6C, 0xF0, 0xFF, 0xFF, 0x03, 0x0C, 0x30, // Code for char 0xB9
+    0x47, 0x04, 0x0A, 0x3C, 0xFA, 0x39, 0x6C, 0xA0, 0x81, 0x0E, 0xEB, 0x27, 0x8F, // Code for char 0xBA
+    0x49, 0x08, 0x09, 0xC7, 0xDD, 0xF1, 0x81, 0x00, 0x00, 0xC0, 0x71, 0x77, 0x7C, 0x20, 0x00, // Code for char 0xBB
+    0x2C, 0x02, 0x11, 0x04, 0x00, 0x05, 0x00, 0xFF, 0x81, 0xFB, 0x83, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x30, 0x70, 0x7C, 0x70, 0x9C, 0x38, 0xF8, 0x3B, 0xF0, 0x1F, 0x00, 0x14, 0x00, 0x00, // Code for char 0xBC
+    0x2C, 0x02, 0x11, 0x04, 0x00, 0x05, 0x00, 0xFF, 0x81, 0xFB, 0x83, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x84, 0x70, 0x84, 0x39, 0x88, 0x3B, 0xF0, 0x1D, 0xC0, 0x19, 0x00, 0x00, // Code for char 0xBD
+    0x3B, 0x02, 0x11, 0x25, 0x80, 0x4B, 0xC0, 0x95, 0xC0, 0xF9, 0xE1, 0xB0, 0xE1, 0x00, 0x70, 0x18, 0x70, 0x3E, 0x38, 0x4E, 0x1C, 0xFC, 0x1D, 0xF8, 0x0F, 0x00, 0x0A, 0x00, 0x00, // Code for char 0xBE
+    0x56, 0x07, 0x11, 0x00, 0x3E, 0x00, 0xFE, 0x00, 0x8E, 0x3B, 0x0F, 0x76, 0x1E, 0xF8, 0x00, 0x30, 0x00, 0x60, // Code for char 0xBF
+    0x3B, 0x00, 0x13, 0x00, 0x00, 0x0F, 0x00, 0xFF, 0x80, 0x3F, 0x8E, 0x9F, 0x61, 0x1F, 0x0C, 0x0A, 0x60, 0xC0, 0x03, 0x03, 0xFC, 0x18, 0x00, 0xFF, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x01, 0x00, 0x0E, // Code for char 0xC0
+    0x3B, 0x00, 0x13, 0x00, 0x00, 0x07, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x9F, 0x41, 0x1F, 0x0C, 0x0B, 0x60, 0xDC, 0x03, 0x63, 0xFC, 0x18, 0x01, 0xFF, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x01, 0x00, 0x0E, // Code for char 0xC1
+    0x3B, 0x00, 0x13, 0x00, 0x00, 0x07, 0x00, 0x3F, 0x81, 0x3F, 0x8C, 0x9F, 0x31, 0x1F, 0x8C, 0x09, 0x60, 0xCC, 0x03, 0xC3, 0xFC, 0x18, 0x04, 0xFF, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x01, 0x00, 0x0E, // Code for char 0xC2
+    0x3B, 0x00, 0x13, 0x00, 0x00, 0x17, 0x00, 0xFF, 0x81, 0x3F, 0x82, 0x9F, 0x11, 0x1F, 0x0C, 0x09, 0x60, 0xD0, 0x03, 0x83, 0xFC, 0x18, 0x07, 0xFF, 0x10, 0xC0, 0x0F, 0x00, 0xF0, 0x01, 0x00, 0x0E, // Code for char 0xC3
+    0x3B, 0x00, 0x13, 0x00, 0x00, 0x07, 0x00, 0xFF, 0x80, 0x3F, 0x86, 0x9F, 0x01, 0x1F, 0x0C, 0x08, 0x60, 0xC0, 0x03, 0x63, 0xFC, 0x18, 0x03, 0xFF, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x01, 0x00, 0x0E, // Code for char 0xC4
+    0x3B, 0x00, 0x13, 0x00, 0x00, 0x07, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x9F, 0x21, 0x1F, 0x8C, 0x0A, 0x60, 0xD4, 0x03, 0x43, 0xFC, 0x18, 0x00, 0xFF, 0x00, 0xC0, 0x0F, 0x00, 0xF0, 0x01, 0x00, 0x0E, // Code for char 0xC5
+    0x2C, 0x04, 0x0F, 0x00, 0x40, 0x00, 0x3C, 0x80, 0x0F, 0xF8, 0x01, 0xCF, 0xF0, 0x61, 0x1C, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0x61, 0xF0, 0x30, 0x78, 0x18, 0x3C, 0x0C, 0x06, // Code for char 0xC6
+    0x3A, 0x04, 0x12, 0xF0, 0x07, 0xE0, 0x7F, 0xC0, 0xC1, 0x83, 0x01, 0x0C, 0x07, 0x70, 0x0F, 0x80, 0x3F, 0x00, 0xDE, 0x00, 0x18, 0x03, 0x60, 0x0C, 0x80, 0x61, 0x00, 0x03, // Code for char 0xC7
+    0x48, 0x00, 0x13, 0xF1, 0xFF, 0x9F, 0xFF, 0xFF, 0x0D, 0x83, 0x6D, 0x18, 0x4C, 0xC3, 0x60, 0x18, 0x06, 0xC3, 0x30, 0x18, 0x86, 0xC1, 0x30, 0x0C, 0x06, // Code for char 0xC8
+    0x48, 0x00, 0x13, 0xF0, 0xFF, 0x87, 0xFF, 0x3F, 0x0C, 0x83, 0x69, 0x18, 0x6C, 0xC3, 0xE0, 0x1B, 0x06, 0xCF, 0x30, 0x38, 0x86, 0xC1, 0x30, 0x0C, 0x06, // Code for char 0xC9
+    0x48, 0x00, 0x13, 0xF0, 0xFF, 0xA7, 0xFF, 0xBF, 0x0D, 0x83, 0x67, 0x18, 0x3C, 0xC3, 0xE0, 0x19, 0x06, 0xDB, 0x30, 0x98, 0x86, 0xC1, 0x30, 0x0C, 0x06, // Code for char 0xCA
+    0x48, 0x00, 0x13, 0xF0, 0xFF, 0x9F, 0xFF, 0xFF, 0x0C, 0x83, 0x61, 0x18, 0x0C, 0xC3, 0x60, 0x18, 0x06, 0xCF, 0x30, 0x78, 0x86, 0xC1, 0x30, 0x0C, 0x06, // Code for char 0xCB
+    0x49, 0x00, 0x13, 0x31, 0x00, 0x9E, 0x01, 0xF0, 0x0D, 0x80, 0x6D, 0x00, 0x4C, 0xFF, 0x7F, 0xF8, 0xFF, 0xC3, 0x00, 0x18, 0x06, 0xC0, 0x30, 0x00, 0x86, 0x01, 0x30, // Code for char 0xCC
+    0x49, 0x00, 0x13, 0x30, 0x00, 0x86, 0x01, 0x30, 0x0C, 0x80, 0x69, 0x00, 0x6C, 0xFF, 0xFF, 0xFB, 0xFF, 0xCF, 0x00, 0x38, 0x06, 0xC0, 0x30, 0x00, 0x86, 0x01, 0x30, // Code for char 0xCD
+    0x49, 0x00, 0x13, 0x30, 0x00, 0xA6, 0x01, 0xB0, 0x0D, 0x80, 0x67, 0x00, 0x3C, 0xFF, 0xFF, 0xF9, 0xFF, 0xDB, 0x00, 0x98, 0x06, 0xC0, 0x30, 0x00, 0x86, 0x01, 0x30, // Code for char 0xCE
+    0x49, 0x00, 0x13, 0x30, 0x00, 0x9E, 0x01, 0xF0, 0x0C, 0x80, 0x61, 0x00, 0x0C, 0xFF, 0x7F, 0xF8, 0xFF, 0xCF, 0x00, 0x78, 0x06, 0xC0, 0x30, 0x00, 0x86, 0x01, 0x30, // Code for char 0xCF
+    0x2C, 0x04, 0x0F, 0xC0, 0x00, 0x60, 0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x1E, 0x06, 0x0F, 0x83, 0x07, 0xC0, 0x03, 0x70, 0x03, 0x98, 0x03, 0x8F, 0xFF, 0x03, 0x7F, 0x00, // Code for char 0xD0
+    0x3A, 0x00, 0x13, 0xF0, 0xFF, 0x97, 0xFF, 0xFF, 0x1D, 0x00, 0xC2, 0x03, 0x10, 0x78, 0x00, 0x01, 0x1E, 0x10, 0xC0, 0x83, 0x00, 0x78, 0x07, 0x00, 0x97, 0xFF, 0x3F, 0xFC, 0xFF, 0x01, // Code for char 0xD1
+    0x3B, 0x00, 0x13, 0x00, 0x7F, 0x08, 0xFE, 0xCF, 0x38, 0xE0, 0xCE, 0x00, 0x6E, 0x03, 0x60, 0x1A, 0x00, 0xC3, 0x00, 0x18, 0x06, 0xC0, 0x70, 0x00, 0x03, 0x07, 0x1C, 0xF0, 0x7F, 0x00, 0xFE, 0x00, // Code for char 0xD2
+    0x3B, 0x00, 0x13, 0x00, 0x7F, 0x00, 0xFE, 0x0F, 0x38, 0xE0, 0xC0, 0x00, 0x4E, 0x03, 0x60, 0x1B, 0x00, 0xDF, 0x00, 0x78, 0x06, 0xC0, 0x71, 0x00, 0x03, 0x07, 0x1C, 0xF0, 0x7F, 0x00, 0xFE, 0x00, // Code for char 0xD3
+    0x3B, 0x00, 0x13, 0x00, 0x7F, 0x00, 0xFE, 0x0F, 0x39, 0xE0, 0xCC, 0x00, 0x3E, 0x03, 0xE0, 0x19, 0x00, 0xCF, 0x00, 0xD8, 0x06, 0xC0, 0x74, 0x00, 0x03, 0x07, 0x1C, 0xF0, 0x7F, 0x00, 0xFE, 0x00, // Code for char 0xD4
+    0x3B, 0x00, 0x13, 0x00, 0x7F, 0x10, 0xFE, 0xCF, 0x39, 0xE0, 0xC2, 0x00, 0x1E, 0x03, 0x60, 0x19, 0x00, 0xD3, 0x00, 0x98, 0x06, 0xC0, 0x77, 0x00, 0x13, 0x07, 0x1C, 0xF0, 0x7F, 0x00, 0xFE, 0x00, // Code for char 0xD5
+    0x3B, 0x00, 0x13, 0x00, 0x7F, 0x00, 0xFE, 0xCF, 0x38, 0xE0, 0xC6, 0x00, 0x0E, 0x03, 0x60, 0x18, 0x00, 0xC3, 0x00, 0x78, 0x06, 0xC0, 0x73, 0x00, 0x03, 0x07, 0x1C, 0xF0, 0x7F, 0x00, 0xFE, 0x00, // Code for char 0xD6
+    0x49, 0x07, 0x0A, 0x06, 0x3F, 0xEE, 0x1D, 0x3F, 0x78, 0xE0, 0xC3, 0x9F, 0xF3, 0x87, 0x0B, 0x04, // Code for char 0xD7
+    0x3B, 0x01, 0x15, 0x80, 0x3F, 0x00, 0xFC, 0x1F, 0xC0, 0x01, 0x67, 0x18, 0xC0, 0x8F, 0x01, 0x3E, 0x30, 0xFC, 0x06, 0xF6, 0xC3, 0xC0, 0x07, 0x18, 0x3F, 0x80, 0x61, 0x0E, 0x38, 0x80, 0xFF, 0x03, 0xC0, 0x1F, 0x00, // Code for char 0xD8
+    0x3A, 0x00, 0x13, 0xF0, 0xFF, 0x89, 0xFF, 0xDF, 0x00, 0xC0, 0x0E, 0x00, 0x6C, 0x00, 0x60, 0x02, 0x00, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x00, 0x83, 0xFF, 0x1F, 0xFC, 0x3F, 0x00, // Code for char 0xD9
+    0x3A, 0x00, 0x13, 0xF0, 0xFF, 0x81, 0xFF, 0x1F, 0x00, 0xC0, 0x00, 0x00, 0x4C, 0x00, 0x60, 0x03, 0x00, 0x1F, 0x00, 0x78, 0x00, 0xC0, 0x01, 0x00, 0x83, 0xFF, 0x1F, 0xFC, 0x3F, 0x00, // Code for char 0xDA
+    0x3A, 0x00, 0x13, 0xF0, 0xFF, 0x81, 0xFF, 0x1F, 0x01, 0xC0, 0x0C, 0x00, 0x3C, 0x00, 0xE0, 0x01, 0x00, 0x0F, 0x00, 0xD8, 0x00, 0xC0, 0x04, 0x00, 0x83, 0xFF, 0x1F, 0xFC, 0x3F, 0x00, // Code for char 0xDB
+    0x3A, 0x00, 0x13, 0xF0, 0xFF, 0x81, 0xFF, 0xDF, 0x00, 0xC0, 0x06, 0x00, 0x0C, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x78, 0x00, 0xC0, 0x03, 0x00, 0x83, 0xFF, 0x1F, 0xFC, 0x3F, 0x00, // Code for char 0xDC
+    0x2C, 0x00, 0x13, 0x70, 0x00, 0x00, 0x07, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0xE0, 0x01, 0x02, 0xFC, 0x1B, 0xE0, 0xFF, 0x80, 0x03, 0x03, 0x0F, 0x08, 0x1E, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x00, 0x01, 0x00, // Code for char 0xDD
+    0x49, 0x04, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0x03, 0x83, 0x81, 0xC1, 0xC0, 0x60, 0x60, 0x30, 0x38, 0x30, 0x0C, 0xF8, 0x03, 0xF0, 0x00, // Code for char 0xDE
+    0x49, 0x02, 0x11, 0xFC, 0xFF, 0xFD, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x30, 0x38, 0x78, 0xFC, 0xF0, 0x98, 0x63, 0x1F, 0xCE, 0x1C, 0xF8, 0x00, 0xE0, 0x00, // Code for char 0xDF
+    0x49, 0x02, 0x11, 0x00, 0xF0, 0x82, 0xF1, 0x8D, 0x71, 0x3E, 0x63, 0x6C, 0xC6, 0x98, 0x8C, 0x31, 0x18, 0x73, 0x70, 0x66, 0xC0, 0xFF, 0x01, 0xFF, 0x03, // Code for char 0xE0
+    0x49, 0x02, 0x11, 0x00, 0xF0, 0x80, 0xF1, 0x81, 0x71, 0x26, 0x63, 0x6C, 0xC6, 0xF8, 0x8C, 0xF1, 0x18, 0xF3, 0x70, 0x66, 0xC0, 0xFF, 0x01, 0xFF, 0x03, // Code for char 0xE1
+    0x49, 0x02, 0x11, 0x00, 0xF0, 0x88, 0xF1, 0x99, 0x71, 0x1E, 0x63, 0x1C, 0xC6, 0x78, 0x8C, 0xB1, 0x19, 0x73, 0x72, 0x66, 0xC0, 0xFF, 0x01, 0xFF, 0x03, // Code for char 0xE2
+    0x49, 0x02, 0x11, 0x02, 0xF0, 0x8E, 0xF1, 0x85, 0x71, 0x0E, 0x63, 0x2C, 0xC6, 0x98, 0x8C, 0x31, 0x19, 0xF3, 0x73, 0x66, 0xC2, 0xFF, 0x01, 0xFF, 0x03, // Code for char 0xE3
+    0x49, 0x02, 0x11, 0x00, 0xF0, 0x8E, 0xF1, 0x9D, 0x71, 0x3E, 0x63, 0x0C, 0xC6, 0x18, 0x8C, 0xF1, 0x19, 0xF3, 0x73, 0x66, 0xC7, 0xFF, 0x01, 0xFF, 0x03, // Code for char 0xE4
+    0x49, 0x02, 0x11, 0x00, 0xF0, 0x80, 0xF1, 0x99, 0x71, 0x4E, 0x63, 0x9C, 0xC6, 0xD8, 0x8C, 0x31, 0x18, 0x73, 0x70, 0x66, 0xC0, 0xFF, 0x01, 0xFF, 0x03, // Code for char 0xE5
+    0x2B, 0x07, 0x0C, 0xC0, 0x67, 0xFE, 0x63, 0x3C, 0xC6, 0x63, 0xF6, 0x3F, 0xFE, 0x77, 0xE6, 0x63, 0x3C, 0xC6, 0x7E, 0xCC, 0xC7, // Code for char 0xE6
+    0x48, 0x07, 0x0F, 0xF8, 0x01, 0xFE, 0x83, 0xC3, 0xE1, 0xC0, 0x3D, 0xC0, 0x1F, 0xE0, 0x0D, 0x30, 0x06, 0x18, 0x06, 0x06, // Code for char 0xE7
+    0x39, 0x02, 0x11, 0x00, 0x3F, 0x00, 0xFF, 0x05, 0x33, 0x1B, 0x63, 0x7C, 0xC6, 0xD8, 0x8C, 0x31, 0x19, 0x63, 0x60, 0xC6, 0xC0, 0xCF, 0x00, 0x1E, 0x00, // Code for char 0xE8
+    0x39, 0x02, 0x11, 0x00, 0x3F, 0x00, 0xFF, 0x01, 0x33, 0x03, 0x63, 0x4C, 0xC6, 0xD8, 0x8C, 0xF1, 0x19, 0xE3, 0x61, 0xC6, 0xC1, 0xCF, 0x00, 0x1E, 0x00, // Code for char 0xE9
+    0x39, 0x02, 0x11, 0x00, 0x3F, 0x00, 0xFF, 0x11, 0x33, 0x33, 0x63, 0x3C, 0xC6, 0x38, 0x8C, 0xF1, 0x18, 0x63, 0x63, 0xC6, 0xC4, 0xCF, 0x00, 0x1E, 0x00, // Code for char 0xEA
+    0x39, 0x02, 0x11, 0x00, 0x3F, 0x00, 0xFF, 0x1D, 0x33, 0x3B, 0x63, 0x7C, 0xC6, 0x18, 0x8C, 0x31, 0x18, 0xE3, 0x63, 0xC6, 0xC7, 0xCF, 0x0E, 0x1E, 0x00, // Code for char 0xEB
+    0x48, 0x02, 0x11, 0x60, 0x80, 0xC3, 0x00, 0x8F, 0x01, 0x3E, 0x03, 0x6C, 0xFE, 0x9F, 0xFC, 0x3F, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x80, 0x01, // Code for char 0xEC
+    0x48, 0x02, 0x11, 0x60, 0x80, 0xC1, 0x00, 0x83, 0x01, 0x26, 0x03, 0x6C, 0xFE, 0xFF, 0xFC, 0xFF, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0x80, 0x01, // Code for char 0xED
+    0x48, 0x02, 0x11, 0x60, 0x80, 0xC9, 0x00, 0x9B, 0x01, 0x1E, 0x03, 0x1C, 0xFE, 0x7F, 0xFC, 0xBF, 0x01, 0x60, 0x02, 0xC0, 0x00, 0x80, 0x01, // Code for char 0xEE
+    0x48, 0x02, 0x11, 0x60, 0x80, 0xCF, 0x00, 0x9F, 0x01, 0x3E, 0x03, 0x0C, 0xFE, 0x1F, 0xFC, 0xFF, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x01, // Code for char 0xEF
+    0x3A, 0x02, 0x11, 0x00, 0x3E, 0x00, 0xFF, 0x31, 0x87, 0x6B, 0x07, 0x7E, 0x06, 0xF8, 0x0C, 0xB0, 0x1F, 0x60, 0x3F, 0xE0, 0xF3, 0xE1, 0x86, 0xFF, 0x00, 0xFC, 0x00, // Code for char 0xF0
+    0x48, 0x02, 0x11, 0xE2, 0xFF, 0xCF, 0xFF, 0x07, 0x07, 0x08, 0x06, 0x20, 0x06, 0x80, 0x0C, 0x00, 0x39, 0x80, 0xE3, 0xFF, 0x82, 0xFF, 0x01, // Code for char 0xF1
+    0x3A, 0x02, 0x11, 0x00, 0x3F, 0x00, 0xFF, 0x05, 0x87, 0x1B, 0x07, 0x7E, 0x06, 0xD8, 0x0C, 0x30, 0x19, 0x60, 0x70, 0xE0, 0xC0, 0xE1, 0x80, 0xFF, 0x00, 0xFC, 0x00, // Code for char 0xF2
+    0x3A, 0x02, 0x11, 0x00, 0x3F, 0x00, 0xFF, 0x01, 0x87, 0x03, 0x07, 0x4E, 0x06, 0xD8, 0x0C, 0xF0, 0x19, 0xE0, 0x71, 0xE0, 0xC1, 0xE1, 0x80, 0xFF, 0x00, 0xFC, 0x00, // Code for char 0xF3
+    0x3A, 0x02, 0x11, 0x00, 0x3F, 0x00, 0xFF, 0x11, 0x87, 0x33, 0x07, 0x3E, 0x06, 0x38, 0x0C, 0xF0, 0x18, 0x60, 0x73, 0xE0, 0xC4, 0xE1, 0x80, 0xFF, 0x00, 0xFC, 0x00, // Code for char 0xF4
+    0x3A, 0x02, 0x11, 0x00, 0x3F, 0x04, 0xFF, 0x1D, 0x87, 0x0B, 0x07, 0x1E, 0x06, 0x58, 0x0C, 0x30, 0x19, 0x60, 0x72, 0xE0, 0xC7, 0xE1, 0x84, 0xFF, 0x00, 0xFC, 0x00, // Code for char 0xF5
+    0x3A, 0x02, 0x11, 0x00, 0x3F, 0x00, 0xFF, 0x1D, 0x87, 0x3B, 0x07, 0x7E, 0x06, 0x18, 0x0C, 0x30, 0x18, 0xE0, 0x73, 0xE0, 0xC7, 0xE1, 0x8E, 0xFF, 0x00, 0xFC, 0x00, // Code for char 0xF6
+    0x3A, 0x06, 0x0C, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x67, 0x7E, 0xE6, 0x67, 0x0E, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, // Code for char 0xF7
+    0x3A, 0x05, 0x11, 0xE0, 0x07, 0xE0, 0x1F, 0xE0, 0x70, 0xE6, 0xC0, 0xCF, 0xE0, 0x83, 0xF9, 0x06, 0x3F, 0x8C, 0x0F, 0x1C, 0x3B, 0x1C, 0xE0, 0x1F, 0x80, 0x1F, 0x00, // Code for char 0xF8
+    0x48, 0x02, 0x11, 0xE0, 0x7F, 0xC2, 0xFF, 0x0D, 0x00, 0x3F, 0x00, 0x6C, 0x00, 0x98, 0x00, 0x18, 0x00, 0x38, 0xF0, 0xFF, 0xE0, 0xFF, 0x01, // Code for char 0xF9
+    0x48, 0x02, 0x11, 0xE0, 0x7F, 0xC0, 0xFF, 0x01, 0x00, 0x27, 0x00, 0x6C, 0x00, 0xF8, 0x00, 0xD8, 0x00, 0xB8, 0xF0, 0xFF, 0xE0, 0xFF, 0x01, // Code for char 0xFA
+    0x48, 0x02, 0x11, 0xE0, 0x7F, 0xC8, 0xFF, 0x19, 0x00, 0x1F, 0x00, 0x1C, 0x00, 0x78, 0x00, 0x98, 0x01, 0x38, 0xF2, 0xFF, 0xE0, 0xFF, 0x01, // Code for char 0xFB
+    0x48, 0x02, 0x11, 0xE0, 0x7F, 0xCE, 0xFF, 0x1D, 0x00, 0x3F, 0x00, 0x0C, 0x00, 0x18, 0x00, 0xD8, 0x01, 0xB8, 0xF3, 0xFF, 0xE7, 0xFF, 0x01, // Code for char 0xFC
+    0x2B, 0x02, 0x16, 0x00, 0x00, 0x30, 0x38, 0x00, 0x0C, 0x3E, 0x00, 0x03, 0x7E, 0xE0, 0x00, 0x7C, 0x1C, 0x01, 0xFC, 0x63, 0x00, 0x78, 0x1C, 0xC0, 0x07, 0x03, 0x3C, 0x40, 0xE0, 0x03, 0x00, 0x3E, 0x00, 0x80, 0x01, 0x00, // Code for char 0xFD
+    0x49, 0x02, 0x16, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x1C, 0x18, 0x00, 0x03, 0x06, 0x60, 0x80, 0x01, 0x18, 0x60, 0x00, 0x06, 0x1C, 0x80, 0x83, 0x03, 0xC0, 0x7F, 0x00, 0xC0, 0x0F, 0x00, // Code for char 0xFE
+    0x2B, 0x02, 0x16, 0x00, 0x00, 0x30, 0x38, 0x00, 0x0C, 0x3E, 0x00, 0x1F, 0x7E, 0xE0, 0x07, 0x7C, 0xDC, 0x01, 0xFC, 0x03, 0x00, 0x78, 0x00, 0xC0, 0x07, 0x07, 0x3C, 0xC0, 0xE1, 0x03, 0x70, 0x3E, 0x00, 0x80, 0x01, 0x00 // Code for char 0xFF
+};
+
+///
+/// @brief Offsets of characters 32, 48, 64... in Terminal16x24p
+///
+static const uint16_t Terminal16x24pIndex[14] =
+{
+    0, 272, 582, 961, 1327, 1666, 1981, 2079, 2159, 2405, 2678, 3134, 3604, 3987
+};
+
+#endif // TERMINAL16P_FONT_RELEASE
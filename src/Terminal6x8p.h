@@ -0,0 +1,284 @@
+///
+/// @file Terminal6x8p.h
+/// @brief Font Terminal 6 x 8, packed
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 16 Oct 2026
+/// @version 523
+///
+/// @copyright (c) Rei Vilo, 2010-2023
+/// @copyright All rights reserved
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+
+//
+// Terminal6x8p.h
+// Font library
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+
+#ifndef TERMINAL6P_FONT_RELEASE
+///
+/// @brief Release
+///
+#define TERMINAL6P_FONT_RELEASE 523
+
+///
+/// @brief Font Terminal6x8, packed
+/// @details Same glyphs as Terminal6x8e.h, 1246 bytes instead of 1344
+/// @n Per character
+/// * 1 byte, first column << 4 | (number of columns - 1), 0xff = blank
+/// * 1 byte, first row << 4 | (number of rows - 1)
+/// * bitstream, columns of rows, first bit on LSB
+///
+static const uint8_t Terminal6x8p[1246] =
+{
+    0xFF, // Code for char space
+    0x22, 0x06, 0x86, 0xAF, 0x01, // Code for char !
+    0x14, 0x02, 0x1F, 0x3E, // Code for char "
+    0x14, 0x15, 0xD2, 0x2F, 0xFD, 0x12, // Code for char #
+    0x13, 0x06, 0xA4, 0x95, 0x5A, 0x02, // Code for char $
+    0x14, 0x06, 0xE3, 0x09, 0x82, 0x3C, 0x06, // Code for char %
+    0x14, 0x06, 0xB6, 0xA4, 0x15, 0x04, 0x05, // Code for char &
+    0x21, 0x02, 0x1F, // Code for char '
+    0x21, 0x06, 0xBE, 0x20, // Code for char (
+    0x21, 0x06, 0x41, 0x1F, // Code for char )
+    0x14, 0x14, 0xE4, 0xBB, 0x4F, 0x00, // Code for char *
+    0x14, 0x14, 0x84, 0x7C, 0x42, 0x00, // Code for char +
+    0x21, 0x52, 0x1F, // Code for char ,
+    0x14, 0x30, 0x1F, // Code for char -
+    0x21, 0x51, 0x0F, // Code for char .
+    0x14, 0x14, 0x10, 0x11, 0x11, 0x00, // Code for char /
+    0x14, 0x06, 0xBE, 0x68, 0xB2, 0xE8, 0x03, // Code for char 0
+    0x22, 0x06, 0xC2, 0x3F, 0x10, // Code for char 1
+    0x14, 0x06, 0xE2, 0x68, 0x32, 0x69, 0x04, // Code for char 2
+    0x14, 0x06, 0xA2, 0x64, 0x32, 0x69, 0x03, // Code for char 3
+    0x14, 0x06, 0x18, 0x8A, 0xE4, 0x0F, 0x01, // Code for char 4
+    0x14, 0x06, 0xAF, 0x64, 0x32, 0x19, 0x03, // Code for char 5
+    0x14, 0x06, 0x3C, 0x65, 0x32, 0x09, 0x03, // Code for char 6
+    0x14, 0x06, 0x81, 0x78, 0xA2, 0x30, 0x00, // Code for char 7
+    0x14, 0x06, 0xB6, 0x64, 0x32, 0x69, 0x03, // Code for char 8
+    0x14, 0x06, 0x86, 0x64, 0x32, 0xE5, 0x01, // Code for char 9
+    0x21, 0x24, 0x7B, 0x03, // Code for char :
+    0x21, 0x25, 0xFB, 0x06, // Code for char ;
+    0x13, 0x06, 0x08, 0x8A, 0x28, 0x08, // Code for char <
+    0x14, 0x23, 0x99, 0x99, 0x09, // Code for char =
+    0x23, 0x06, 0x41, 0x11, 0x05, 0x01, // Code for char >
+    0x14, 0x06, 0x82, 0x40, 0x36, 0x61, 0x00, // Code for char ?
+    0x14, 0x06, 0xBE, 0x60, 0xB7, 0xEA, 0x01, // Code for char @
+    0x14, 0x06, 0xFE, 0x48, 0x24, 0xE2, 0x07, // Code for char A
+    0x14, 0x06, 0xFF, 0x64, 0x32, 0x69, 0x03, // Code for char B
+    0x14, 0x06, 0xBE, 0x60, 0x30, 0x28, 0x02, // Code for char C
+    0x14, 0x06, 0xFF, 0x60, 0x30, 0xE8, 0x03, // Code for char D
+    0x14, 0x06, 0xFF, 0x64, 0x32, 0x19, 0x04, // Code for char E
+    0x14, 0x06, 0xFF, 0x44, 0x22, 0x11, 0x00, // Code for char F
+    0x14, 0x06, 0xBE, 0x60, 0x32, 0xA9, 0x07, // Code for char G
+    0x14, 0x06, 0x7F, 0x04, 0x02, 0xF1, 0x07, // Code for char H
+    0x22, 0x06, 0xC1, 0x7F, 0x10, // Code for char I
+    0x14, 0x06, 0x30, 0x20, 0x10, 0xF8, 0x03, // Code for char J
+    0x14, 0x06, 0x7F, 0x04, 0x45, 0x14, 0x04, // Code for char K
+    0x14, 0x06, 0x7F, 0x20, 0x10, 0x08, 0x04, // Code for char L
+    0x14, 0x06, 0x7F, 0x01, 0x41, 0xF0, 0x07, // Code for char M
+    0x14, 0x06, 0x7F, 0x01, 0x01, 0xF1, 0x07, // Code for char N
+    0x14, 0x06, 0xBE, 0x60, 0x30, 0xE8, 0x03, // Code for char O
+    0x14, 0x06, 0xFF, 0x44, 0x22, 0x61, 0x00, // Code for char P
+    0x14, 0x06, 0xBE, 0x60, 0x34, 0xE4, 0x05, // Code for char Q
+    0x14, 0x06, 0xFF, 0x44, 0x22, 0x63, 0x06, // Code for char R
+    0x14, 0x06, 0xA6, 0x64, 0x32, 0x29, 0x03, // Code for char S
+    0x14, 0x06, 0x81, 0xC0, 0x3F, 0x10, 0x00, // Code for char T
+    0x14, 0x06, 0x3F, 0x20, 0x10, 0xF8, 0x03, // Code for char U
+    0x14, 0x06, 0x1F, 0x10, 0x10, 0xF4, 0x01, // Code for char V
+    0x14, 0x06, 0x3F, 0x20, 0x0F, 0xF8, 0x03, // Code for char W
+    0x14, 0x06, 0x63, 0x0A, 0x82, 0x32, 0x06, // Code for char X
+    0x14, 0x06, 0x07, 0x04, 0x1C, 0x71, 0x00, // Code for char Y
+    0x13, 0x06, 0xF1, 0x64, 0x71, 0x08, // Code for char Z
+    0x22, 0x06, 0xFF, 0x60, 0x10, // Code for char [
+    0x14, 0x14, 0x41, 0x10, 0x04, 0x01, // Code for char 0x5C
+    0x22, 0x06, 0xC1, 0xE0, 0x1F, // Code for char ]
+    0x14, 0x02, 0x54, 0x44, // Code for char ^
+    0x05, 0x70, 0x3F, // Code for char _
+    0x21, 0x02, 0x3B, // Code for char `
+    0x14, 0x24, 0xA8, 0xD6, 0xEA, 0x01, // Code for char a
+    0x14, 0x06, 0x7F, 0x22, 0x91, 0x88, 0x03, // Code for char b
+    0x14, 0x24, 0x2E, 0xC6, 0xA8, 0x00, // Code for char c
+    0x14, 0x06, 0x38, 0x22, 0x91, 0xF8, 0x07, // Code for char d
+    0x14, 0x24, 0xAE, 0xD6, 0x2A, 0x00, // Code for char e
+    0x13, 0x06, 0x08, 0x7F, 0x22, 0x01, // Code for char f
+    0x14, 0x25, 0x46, 0x9A, 0xA6, 0x1F, // Code for char g
+    0x13, 0x06, 0x7F, 0x02, 0x01, 0x0F, // Code for char h
+    0x31, 0x06, 0x7D, 0x20, // Code for char i
+    0x13, 0x07, 0x40, 0x80, 0x84, 0x7D, // Code for char j
+    0x13, 0x06, 0x7F, 0x08, 0x8A, 0x08, // Code for char k
+    0x31, 0x06, 0x7F, 0x20, // Code for char l
+    0x14, 0x24, 0x3F, 0x98, 0xE0, 0x01, // Code for char m
+    0x13, 0x24, 0x3F, 0x04, 0x0F, // Code for char n
+    0x14, 0x24, 0x2E, 0xC6, 0xE8, 0x00, // Code for char o
+    0x14, 0x25, 0x7F, 0x14, 0x45, 0x0E, // Code for char p
+    0x14, 0x25, 0x4E, 0x14, 0x45, 0x3F, // Code for char q
+    0x14, 0x24, 0xD1, 0xC7, 0x20, 0x00, // Code for char r
+    0x14, 0x24, 0xA2, 0xD6, 0x8A, 0x00, // Code for char s
+    0x13, 0x15, 0xC2, 0x27, 0x4A, // Code for char t
+    0x13, 0x24, 0x0F, 0xA2, 0x0F, // Code for char u
+    0x14, 0x24, 0x07, 0x41, 0x74, 0x00, // Code for char v
+    0x14, 0x24, 0x0F, 0x33, 0xFC, 0x00, // Code for char w
+    0x13, 0x24, 0x9B, 0x90, 0x0D, // Code for char x
+    0x13, 0x25, 0x27, 0x8A, 0x3D, // Code for char y
+    0x13, 0x24, 0xB9, 0xD6, 0x09, // Code for char z
+    0x13, 0x06, 0x08, 0x5F, 0x30, 0x08, // Code for char {
+    0x30, 0x06, 0x77, // Code for char |
+    0x23, 0x06, 0xC1, 0xA0, 0x0F, 0x01, // Code for char }
+    0x13, 0x01, 0x66, // Code for char ~
+    0x14, 0x05, 0xBC, 0x39, 0x9A, 0x3C, // Code for char 0x7F
+    0x14, 0x06, 0x14, 0x5F, 0x35, 0x18, 0x02, // Code for char 0x80
+    0xFF, // Code for char 0x81
+    0x21, 0x52, 0x1F, // Code for char 0x82
+    0x13, 0x06, 0x40, 0x9A, 0xA3, 0x00, // Code for char 0x83
+    0x14, 0x52, 0x1F, 0x3E, // Code for char 0x84
+    0x14, 0x60, 0x15, // Code for char 0x85
+    0x22, 0x05, 0xC2, 0x2F, 0x00, // Code for char 0x86
+    0x22, 0x05, 0xD2, 0x2F, 0x01, // Code for char 0x87
+    0x22, 0x01, 0x26, // Code for char 0x88
+    0x14, 0x06, 0xE3, 0x09, 0x92, 0x30, 0x04, // Code for char 0x89
+    0x14, 0x06, 0xCC, 0xAA, 0xB5, 0x4A, 0x06, // Code for char 0x8A
+    0x21, 0x22, 0x2A, // Code for char 0x8B
+    0x14, 0x06, 0xBE, 0xE0, 0x3F, 0x19, 0x04, // Code for char 0x8C
+    0xFF, // Code for char 0x8D
+    0x13, 0x06, 0xE4, 0xAA, 0xB5, 0x09, // Code for char 0x8E
+    0xFF, // Code for char 0x8F
+    0xFF, // Code for char 0x90
+    0x21, 0x02, 0x3E, // Code for char 0x91
+    0x21, 0x02, 0x1F, // Code for char 0x92
+    0x14, 0x02, 0x37, 0x6E, // Code for char 0x93
+    0x14, 0x02, 0x3B, 0x76, // Code for char 0x94
+    0x21, 0x31, 0x0F, // Code for char 0x95
+    0x12, 0x30, 0x07, // Code for char 0x96
+    0x14, 0x30, 0x1F, // Code for char 0x97
+    0x13, 0x31, 0x66, // Code for char 0x98
+    0x05, 0x02, 0x79, 0x9E, 0x03, // Code for char 0x99
+    0x14, 0x06, 0x88, 0xAA, 0xB5, 0x0A, 0x02, // Code for char 0x9A
+    0x21, 0x22, 0x15, // Code for char 0x9B
+    0x14, 0x24, 0x2E, 0xBA, 0x2A, 0x01, // Code for char 0x9C
+    0xFF, // Code for char 0x9D
+    0x13, 0x06, 0xE4, 0xAA, 0xB5, 0x09, // Code for char 0x9E
+    0x14, 0x06, 0x84, 0x04, 0x3C, 0x41, 0x00, // Code for char 0x9F
+    0xFF, // Code for char 0xA0
+    0x22, 0x16, 0xB0, 0x3E, 0x0C, // Code for char 0xA1
+    0x13, 0x15, 0x8C, 0x34, 0x4B, // Code for char 0xA2
+    0x14, 0x06, 0x48, 0x5F, 0x32, 0x28, 0x02, // Code for char 0xA3
+    0x14, 0x06, 0x5D, 0x91, 0x48, 0xD4, 0x05, // Code for char 0xA4
+    0x14, 0x06, 0x29, 0x15, 0x5F, 0x95, 0x02, // Code for char 0xA5
+    0x30, 0x06, 0x77, // Code for char 0xA6
+    0x14, 0x06, 0xA6, 0x66, 0x35, 0x2B, 0x03, // Code for char 0xA7
+    0x22, 0x10, 0x05, // Code for char 0xA8
+    0x05, 0x06, 0xBE, 0x60, 0xB7, 0x1A, 0xF4, 0x01, // Code for char 0xA9
+    0x14, 0x06, 0x88, 0x6A, 0xB5, 0xEA, 0x05, // Code for char 0xAA
+    0x14, 0x22, 0x2A, 0x54, // Code for char 0xAB
+    0x14, 0x22, 0x49, 0x72, // Code for char 0xAC
+    0x22, 0x06, 0xB0, 0x3E, 0x0C, // Code for char 0xAD
+    0x05, 0x06, 0xBE, 0x60, 0x77, 0x59, 0xF5, 0x01, // Code for char 0xAE
+    0x05, 0x00, 0x3F, // Code for char 0xAF
+    0x13, 0x06, 0xCE, 0x68, 0xD4, 0x09, // Code for char 0xB0
+    0x22, 0x14, 0xF2, 0x4A, // Code for char 0xB1
+    0x12, 0x03, 0xD9, 0x0A, // Code for char 0xB2
+    0x12, 0x03, 0xF9, 0x05, // Code for char 0xB3
+    0x31, 0x00, 0x03, // Code for char 0xB4
+    0x13, 0x25, 0x3F, 0x82, 0x1C, // Code for char 0xB5
+    0x14, 0x06, 0x86, 0xC4, 0x3F, 0xF0, 0x07, // Code for char 0xB6
+    0x20, 0x30, 0x01, // Code for char 0xB7
+    0x22, 0x61, 0x1E, // Code for char 0xB8
+    0x11, 0x03, 0xF2, // Code for char 0xB9
+    0x13, 0x03, 0x96, 0x69, // Code for char 0xBA
+    0x14, 0x22, 0x15, 0x2A, // Code for char 0xBB
+    0x14, 0x06, 0x17, 0x04, 0x4D, 0x85, 0x07, // Code for char 0xBC
+    0x14, 0x06, 0x17, 0x04, 0x53, 0x0D, 0x05, // Code for char 0xBD
+    0x05, 0x06, 0x85, 0x8B, 0x82, 0xA6, 0xCA, 0x03, // Code for char 0xBE
+    0x14, 0x06, 0x30, 0x64, 0x13, 0x08, 0x02, // Code for char 0xBF
+    0x14, 0x06, 0xF0, 0x54, 0x09, 0x05, 0x07, // Code for char 0xC0
+    0x14, 0x06, 0x70, 0x54, 0x29, 0x05, 0x07, // Code for char 0xC1
+    0x14, 0x06, 0xF0, 0x54, 0x29, 0x05, 0x07, // Code for char 0xC2
+    0x14, 0x06, 0x70, 0x55, 0x49, 0x15, 0x07, // Code for char 0xC3
+    0x14, 0x06, 0xF0, 0x14, 0x29, 0x05, 0x07, // Code for char 0xC4
+    0x14, 0x06, 0x70, 0x55, 0x4B, 0x05, 0x07, // Code for char 0xC5
+    0x14, 0x06, 0xFE, 0xC8, 0x3F, 0x19, 0x04, // Code for char 0xC6
+    0x14, 0x07, 0x1E, 0xA1, 0xE1, 0x61, 0x12, // Code for char 0xC7
+    0x14, 0x06, 0xFC, 0x6A, 0x95, 0x4A, 0x04, // Code for char 0xC8
+    0x14, 0x06, 0x7C, 0x6A, 0xB5, 0x4A, 0x04, // Code for char 0xC9
+    0x14, 0x06, 0xFC, 0x6A, 0xB5, 0x4A, 0x04, // Code for char 0xCA
+    0x14, 0x06, 0xFC, 0x2A, 0xB5, 0x4A, 0x04, // Code for char 0xCB
+    0x22, 0x06, 0xC5, 0x3E, 0x11, // Code for char 0xCC
+    0x22, 0x06, 0xC4, 0x7E, 0x11, // Code for char 0xCD
+    0x22, 0x06, 0xC5, 0x7E, 0x11, // Code for char 0xCE
+    0x22, 0x06, 0x45, 0x7E, 0x11, // Code for char 0xCF
+    0x14, 0x06, 0x88, 0x7F, 0x32, 0xE8, 0x03, // Code for char 0xD0
+    0x13, 0x06, 0xFA, 0x88, 0x28, 0x0F, // Code for char 0xD1
+    0x13, 0x06, 0xBD, 0xA1, 0x90, 0x07, // Code for char 0xD2
+    0x13, 0x06, 0x3C, 0xE1, 0xB0, 0x07, // Code for char 0xD3
+    0x13, 0x06, 0xBC, 0xE1, 0xB0, 0x07, // Code for char 0xD4
+    0x13, 0x06, 0xBE, 0xA2, 0xB0, 0x07, // Code for char 0xD5
+    0x13, 0x06, 0x3C, 0xE1, 0xB0, 0x07, // Code for char 0xD6
+    0x22, 0x32, 0x55, 0x01, // Code for char 0xD7
+    0x14, 0x06, 0xFE, 0x70, 0x77, 0xF8, 0x03, // Code for char 0xD8
+    0x13, 0x06, 0x3C, 0x60, 0xB0, 0x07, // Code for char 0xD9
+    0x13, 0x06, 0xBD, 0x20, 0x90, 0x07, // Code for char 0xDA
+    0x13, 0x06, 0xBC, 0x60, 0xB0, 0x07, // Code for char 0xDB
+    0x13, 0x06, 0xBC, 0x20, 0xB0, 0x07, // Code for char 0xDC
+    0x14, 0x06, 0x04, 0x44, 0x3C, 0x41, 0x00, // Code for char 0xDD
+    0x13, 0x16, 0xFF, 0x2A, 0x05, 0x01, // Code for char 0xDE
+    0x13, 0x16, 0xFF, 0x52, 0x49, 0x03, // Code for char 0xDF
+    0x14, 0x06, 0xA0, 0x6A, 0x95, 0x8A, 0x07, // Code for char 0xE0
+    0x14, 0x06, 0x20, 0x2A, 0xB5, 0x9A, 0x07, // Code for char 0xE1
+    0x14, 0x06, 0xA0, 0x6A, 0xB5, 0x8A, 0x07, // Code for char 0xE2
+    0x14, 0x06, 0x20, 0x6B, 0xD5, 0xDA, 0x07, // Code for char 0xE3
+    0x14, 0x06, 0xA0, 0x2A, 0xB5, 0x8A, 0x07, // Code for char 0xE4
+    0x14, 0x06, 0xA0, 0x6B, 0xF5, 0xCA, 0x07, // Code for char 0xE5
+    0x13, 0x25, 0x3F, 0x82, 0x1C, // Code for char 0xE6
+    0x14, 0x25, 0x4E, 0x1C, 0x47, 0x0A, // Code for char 0xE7
+    0x13, 0x06, 0xB9, 0x2A, 0x15, 0x01, // Code for char 0xE8
+    0x13, 0x06, 0x38, 0x6A, 0x35, 0x01, // Code for char 0xE9
+    0x13, 0x06, 0xB8, 0x6A, 0x35, 0x01, // Code for char 0xEA
+    0x13, 0x06, 0xB8, 0x2A, 0x35, 0x01, // Code for char 0xEB
+    0x22, 0x06, 0x81, 0x3E, 0x10, // Code for char 0xEC
+    0x31, 0x06, 0xFD, 0x20, // Code for char 0xED
+    0x22, 0x06, 0x81, 0x7E, 0x10, // Code for char 0xEE
+    0x22, 0x06, 0x01, 0x7E, 0x10, // Code for char 0xEF
+    0x14, 0x06, 0xB9, 0x63, 0xD1, 0xD8, 0x03, // Code for char 0xF0
+    0x13, 0x06, 0xFA, 0x84, 0x22, 0x0E, // Code for char 0xF1
+    0x13, 0x06, 0xB9, 0x22, 0x11, 0x07, // Code for char 0xF2
+    0x13, 0x06, 0x38, 0x62, 0x31, 0x07, // Code for char 0xF3
+    0x13, 0x06, 0xB8, 0x62, 0x31, 0x07, // Code for char 0xF4
+    0x13, 0x06, 0xBA, 0xA2, 0x31, 0x07, // Code for char 0xF5
+    0x13, 0x06, 0xB8, 0x22, 0x31, 0x07, // Code for char 0xF6
+    0x14, 0x14, 0x84, 0x54, 0x42, 0x00, // Code for char 0xF7
+    0x14, 0x24, 0x36, 0x55, 0xD9, 0x00, // Code for char 0xF8
+    0x13, 0x06, 0xBD, 0x20, 0x88, 0x0F, // Code for char 0xF9
+    0x13, 0x06, 0x3C, 0x60, 0xA8, 0x0F, // Code for char 0xFA
+    0x13, 0x06, 0xBC, 0x60, 0xA8, 0x0F, // Code for char 0xFB
+    0x13, 0x06, 0xBC, 0x20, 0xA8, 0x0F, // Code for char 0xFC
+    0x13, 0x07, 0x9C, 0xA0, 0x61, 0x3D, // Code for char 0xFD
+    0x13, 0x07, 0xFF, 0xA5, 0x24, 0x18, // Code for char 0xFE
+    0x13, 0x07, 0x9C, 0xA1, 0x60, 0x3D // Code for char 0xFF
+};
+
+///
+/// @brief Offsets of characters 32, 48, 64... in Terminal6x8p
+///
+static const uint16_t Terminal6x8pIndex[14] =
+{
+    0, 74, 174, 284, 383, 473, 558, 627, 689, 773, 852, 956, 1053, 1149
+};
+
+#endif // TERMINAL6P_FONT_RELEASE
@@ -0,0 +1,284 @@
+///
+/// @file Terminal8x12p.h
+/// @brief Font Terminal 8 x 12, packed
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 16 Oct 2026
+/// @version 523
+///
+/// @copyright (c) Rei Vilo, 2010-2023
+/// @copyright All rights reserved
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+
+//
+// Terminal8x12p.h
+// Font library
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+
+#ifndef TERMINAL8P_FONT_RELEASE
+///
+/// @brief Release
+///
+#define TERMINAL8P_FONT_RELEASE 523
+
+///
+/// @brief Font Terminal8x12, packed
+/// @details Same glyphs as Terminal8x12e.h, 1765 bytes instead of 3584
+/// @n Per character
+/// * 1 byte, first column << 4 | (number of columns - 1), 0xff = blank
+/// * 1 byte, first row << 4 | (number of rows - 1)
+/// * bitstream, columns of rows, first bit on LSB
+///
+static const uint8_t Terminal8x12p[1765] =
+{
+    0xFF, // Code for char space
+    0x23, 0x18, 0x0E, 0x7E, 0xFF, 0x76, 0x00, // Code for char !
+    0x15, 0x12, 0x3F, 0xF0, 0x03, // Code for char "
+    0x16, 0x18, 0x44, 0xFE, 0xFF, 0x27, 0xF2, 0xFF, 0x3F, 0x11, // Code for char #
+    0x15, 0x0B, 0x0C, 0xE1, 0x31, 0x33, 0x3E, 0xE6, 0xC6, 0x43, 0x18, // Code for char $
+    0x07, 0x0A, 0x06, 0x78, 0x4C, 0x32, 0xDE, 0x66, 0x7B, 0x4C, 0x32, 0x1E, 0x60, // Code for char %
+    0x16, 0x18, 0xF6, 0xFE, 0x27, 0x7C, 0x69, 0x0E, 0x3C, 0x48, // Code for char &
+    0x31, 0x12, 0x3F, // Code for char '
+    0x23, 0x0A, 0xF8, 0xF0, 0xDF, 0xC1, 0x03, 0x08, // Code for char (
+    0x23, 0x0A, 0x01, 0x3C, 0xB8, 0xFF, 0xF0, 0x01, // Code for char )
+    0x16, 0x34, 0xA4, 0x7E, 0xF7, 0x2B, 0x01, // Code for char *
+    0x15, 0x34, 0x84, 0xFC, 0x4F, 0x08, // Code for char +
+    0x32, 0x83, 0xFB, 0x07, // Code for char ,
+    0x15, 0x50, 0x3F, // Code for char -
+    0x32, 0x81, 0x3F, // Code for char .
+    0x15, 0x09, 0x00, 0x03, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x00, // Code for char /
+    0x25, 0x18, 0xFE, 0xFE, 0x87, 0x6D, 0xF8, 0xDF, 0x1F, // Code for char 0
+    0x14, 0x18, 0x04, 0x08, 0x18, 0xF8, 0xFF, 0x1F, // Code for char 1
+    0x15, 0x18, 0x86, 0x8F, 0x87, 0x8D, 0xF9, 0xD1, 0x21, // Code for char 2
+    0x15, 0x18, 0xC6, 0x8E, 0x47, 0x8C, 0xF8, 0xDF, 0x1D, // Code for char 3
+    0x16, 0x18, 0x60, 0xFE, 0x7C, 0x01, 0xC2, 0x9F, 0x3F, 0x10, // Code for char 4
+    0x15, 0x18, 0x1F, 0x3F, 0x46, 0x8C, 0x1C, 0x2F, 0x0C, // Code for char 5
+    0x15, 0x18, 0xF8, 0xF8, 0x3F, 0x5C, 0x98, 0x1F, 0x1E, // Code for char 6
+    0x15, 0x18, 0x01, 0x82, 0xC7, 0xEF, 0xF1, 0x60, 0x00, // Code for char 7
+    0x15, 0x18, 0xEE, 0xFE, 0x67, 0x8C, 0xF9, 0xDF, 0x1D, // Code for char 8
+    0x15, 0x18, 0x1E, 0x7E, 0x86, 0x0E, 0xFF, 0xC7, 0x07, // Code for char 9
+    0x32, 0x36, 0xE3, 0xF1, 0x18, // Code for char :
+    0x32, 0x38, 0x63, 0xC7, 0x8F, 0x03, // Code for char ;
+    0x15, 0x18, 0x10, 0x70, 0xB0, 0x31, 0x36, 0x38, 0x20, // Code for char <
+    0x15, 0x42, 0x6D, 0xDB, 0x02, // Code for char =
+    0x15, 0x18, 0x01, 0x07, 0x1B, 0x63, 0x83, 0x03, 0x02, // Code for char >
+    0x15, 0x18, 0x06, 0x0E, 0xC4, 0xCE, 0xFD, 0xC0, 0x00, // Code for char ?
+    0x07, 0x18, 0xFE, 0xFE, 0x07, 0x8C, 0x99, 0x37, 0xE9, 0x5F, 0xBF, // Code for char @
+    0x15, 0x18, 0xFC, 0xFD, 0x8F, 0x18, 0xE1, 0x9F, 0x3F, // Code for char A
+    0x15, 0x18, 0xFF, 0xFF, 0x47, 0x8C, 0xF8, 0xDF, 0x1D, // Code for char B
+    0x15, 0x18, 0xFE, 0xFE, 0x07, 0x0C, 0x78, 0xDC, 0x18, // Code for char C
+    0x15, 0x18, 0xFF, 0xFF, 0x07, 0x1C, 0xEC, 0x8F, 0x0F, // Code for char D
+    0x15, 0x18, 0xFF, 0xFF, 0x47, 0x8C, 0x18, 0x31, 0x20, // Code for char E
+    0x15, 0x18, 0xFF, 0xFF, 0x47, 0x88, 0x10, 0x21, 0x00, // Code for char F
+    0x15, 0x18, 0xFE, 0xFE, 0x07, 0x0C, 0x79, 0xDE, 0x3C, // Code for char G
+    0x15, 0x18, 0xFF, 0xFF, 0x43, 0x80, 0xF0, 0xFF, 0x3F, // Code for char H
+    0x23, 0x18, 0x01, 0xFF, 0xFF, 0x0F, 0x08, // Code for char I
+    0x15, 0x18, 0xC0, 0x80, 0x03, 0x04, 0xF8, 0xFF, 0x1F, // Code for char J
+    0x15, 0x18, 0xFF, 0xFF, 0x43, 0xE0, 0xF3, 0x7E, 0x30, // Code for char K
+    0x15, 0x18, 0xFF, 0xFF, 0x03, 0x04, 0x08, 0x10, 0x20, // Code for char L
+    0x16, 0x18, 0xFF, 0xFF, 0x13, 0xC0, 0x41, 0xE0, 0xFF, 0x7F, // Code for char M
+    0x16, 0x18, 0xFF, 0xFF, 0x33, 0xC0, 0x00, 0xE3, 0xFF, 0x7F, // Code for char N
+    0x15, 0x18, 0xFE, 0xFE, 0x07, 0x0C, 0xF8, 0xDF, 0x1F, // Code for char O
+    0x15, 0x18, 0xFF, 0xFF, 0x47, 0x88, 0xF0, 0xC1, 0x01, // Code for char P
+    0x15, 0x1A, 0xFE, 0xF8, 0x4F, 0x40, 0x02, 0xF6, 0x7F, 0x7F, 0x02, // Code for char Q
+    0x15, 0x18, 0xFF, 0xFF, 0x47, 0x88, 0xF1, 0xDF, 0x39, // Code for char R
+    0x15, 0x18, 0x86, 0x1E, 0x67, 0x8C, 0x39, 0x5E, 0x18, // Code for char S
+    0x15, 0x18, 0x01, 0x02, 0xFC, 0xFF, 0x1F, 0x20, 0x00, // Code for char T
+    0x15, 0x18, 0xFF, 0xFE, 0x03, 0x04, 0xF8, 0xFF, 0x1F, // Code for char U
+    0x15, 0x18, 0x7F, 0xFE, 0x01, 0x06, 0xFC, 0xEF, 0x0F, // Code for char V
+    0x16, 0x18, 0x3F, 0xFE, 0x03, 0xC7, 0x01, 0xFC, 0xFF, 0x0F, // Code for char W
+    0x15, 0x18, 0xC3, 0xCF, 0x73, 0xC0, 0x71, 0x7E, 0x38, // Code for char X
+    0x15, 0x18, 0x0F, 0x3E, 0xC0, 0x87, 0xFF, 0xE1, 0x01, // Code for char Y
+    0x15, 0x18, 0xC1, 0xC3, 0xC7, 0xCC, 0xF8, 0xF0, 0x20, // Code for char Z
+    0x23, 0x0B, 0xFF, 0xFF, 0xFF, 0x01, 0x18, 0x80, // Code for char [
+    0x15, 0x19, 0x03, 0x3C, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x0C, // Code for char 0x5C
+    0x23, 0x0B, 0x01, 0x18, 0x80, 0xFF, 0xFF, 0xFF, // Code for char ]
+    0x15, 0x01, 0x5E, 0x0B, // Code for char ^
+    0x07, 0xB0, 0xFF, // Code for char _
+    0x32, 0x01, 0x2D, // Code for char `
+    0x15, 0x36, 0xB0, 0x7C, 0x32, 0xF9, 0xF7, 0x03, // Code for char a
+    0x15, 0x18, 0xFF, 0xFF, 0x13, 0x24, 0xC8, 0x1F, 0x1F, // Code for char b
+    0x15, 0x36, 0xBE, 0x7F, 0x30, 0x38, 0x16, 0x01, // Code for char c
+    0x15, 0x18, 0xF8, 0xF8, 0x13, 0x24, 0xF8, 0xFF, 0x3F, // Code for char d
+    0x15, 0x36, 0xBE, 0x7F, 0x32, 0xF9, 0x74, 0x00, // Code for char e
+    0x15, 0x18, 0x10, 0xFC, 0xFF, 0x8F, 0x10, 0x21, 0x02, // Code for char f
+    0x15, 0x38, 0x1E, 0x7F, 0x86, 0x0C, 0xF9, 0xFF, 0x1F, // Code for char g
+    0x15, 0x18, 0xFF, 0xFF, 0x13, 0x20, 0xC0, 0x1F, 0x3F, // Code for char h
+    0x15, 0x09, 0x08, 0x22, 0xB8, 0xFF, 0xFE, 0x00, 0x02, 0x08, // Code for char i
+    0x14, 0x0B, 0x00, 0x88, 0x80, 0x08, 0xB8, 0xFF, 0xFB, 0x07, // Code for char j
+    0x15, 0x18, 0xFF, 0xFF, 0x83, 0x80, 0xC3, 0x9D, 0x31, // Code for char k
+    0x15, 0x18, 0x01, 0x03, 0xFE, 0xFF, 0x0F, 0x10, 0x20, // Code for char l
+    0x16, 0x36, 0xFF, 0x7F, 0xE0, 0x17, 0xF8, 0xFB, 0x01, // Code for char m
+    0x15, 0x36, 0xFF, 0x7F, 0x20, 0xF0, 0xF7, 0x03, // Code for char n
+    0x15, 0x36, 0xBE, 0x7F, 0x30, 0xF8, 0xF7, 0x01, // Code for char o
+    0x15, 0x38, 0xFF, 0xFF, 0x87, 0x08, 0xF1, 0xC3, 0x03, // Code for char p
+    0x15, 0x38, 0x1E, 0x7E, 0x84, 0x08, 0xF1, 0xFF, 0x3F, // Code for char q
+    0x15, 0x36, 0xFF, 0x3F, 0x41, 0x30, 0x18, 0x00, // Code for char r
+    0x15, 0x36, 0xC6, 0x67, 0x32, 0x99, 0x8F, 0x01, // Code for char s
+    0x15, 0x18, 0x04, 0xFE, 0xFD, 0x27, 0x48, 0x90, 0x20, // Code for char t
+    0x15, 0x36, 0xBF, 0x3F, 0x10, 0xF8, 0xFF, 0x03, // Code for char u
+    0x15, 0x36, 0x9F, 0x1F, 0x18, 0xFC, 0xFB, 0x00, // Code for char v
+    0x16, 0x36, 0x9F, 0x3F, 0xD8, 0x03, 0xFE, 0x7F, 0x00, // Code for char w
+    0x15, 0x36, 0xE3, 0x3B, 0x87, 0x73, 0x1F, 0x03, // Code for char x
+    0x15, 0x38, 0x1F, 0x7F, 0x82, 0x06, 0xFF, 0xE7, 0x03, // Code for char y
+    0x15, 0x36, 0xE1, 0x78, 0xB6, 0x79, 0x1C, 0x02, // Code for char z
+    0x14, 0x0A, 0x20, 0x80, 0x83, 0xF7, 0x1E, 0x1F, 0x40, // Code for char {
+    0x31, 0x0B, 0xFF, 0xFF, 0xFF, // Code for char |
+    0x24, 0x0A, 0x01, 0x7C, 0xBC, 0xF7, 0xE0, 0x00, 0x02, // Code for char }
+    0x07, 0x12, 0x5E, 0x66, 0x7A, // Code for char ~
+    0x15, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, // Code for char 0x7F
+    0x15, 0x18, 0x28, 0xFC, 0xFD, 0x4F, 0x19, 0x50, 0x10, // Code for char 0x80
+    0xFF, // Code for char 0x81
+    0x31, 0x83, 0x7B, // Code for char 0x82
+    0xFF, // Code for char 0x83
+    0x24, 0x83, 0x7B, 0xB0, 0x07, // Code for char 0x84
+    0x24, 0x90, 0x15, // Code for char 0x85
+    0x15, 0x19, 0x0C, 0x30, 0xF0, 0xFF, 0xFF, 0x0C, 0x30, 0x00, // Code for char 0x86
+    0x15, 0x19, 0xCC, 0x30, 0xF3, 0xFF, 0xFF, 0xCC, 0x30, 0x03, // Code for char 0x87
+    0xFF, // Code for char 0x88
+    0x15, 0x19, 0x07, 0x14, 0x7C, 0x0C, 0x8C, 0x0C, 0x0C, 0x08, // Code for char 0x89
+    0xFF, // Code for char 0x8A
+    0x21, 0x62, 0x2A, // Code for char 0x8B
+    0x15, 0x19, 0xFE, 0x05, 0x18, 0xE0, 0xFF, 0x11, 0x06, 0x08, // Code for char 0x8C
+    0xFF, // Code for char 0x8D
+    0xFF, // Code for char 0x8E
+    0xFF, // Code for char 0x8F
+    0xFF, // Code for char 0x90
+    0x31, 0x03, 0xDE, // Code for char 0x91
+    0x31, 0x03, 0x7B, // Code for char 0x92
+    0x24, 0x03, 0xDE, 0xE0, 0x0D, // Code for char 0x93
+    0x24, 0x03, 0x7B, 0xB0, 0x07, // Code for char 0x94
+    0x23, 0x43, 0xF6, 0x6F, // Code for char 0x95
+    0x23, 0x60, 0x0F, // Code for char 0x96
+    0x15, 0x60, 0x3F, // Code for char 0x97
+    0x15, 0x11, 0x96, 0x06, // Code for char 0x98
+    0x16, 0x03, 0xF1, 0x01, 0x2F, 0x0F, // Code for char 0x99
+    0xFF, // Code for char 0x9A
+    0x31, 0x62, 0x15, // Code for char 0x9B
+    0xFF, // Code for char 0x9C
+    0xFF, // Code for char 0x9D
+    0xFF, // Code for char 0x9E
+    0xFF, // Code for char 0x9F
+    0xFF, // Code for char 0xA0
+    0x23, 0x38, 0xE0, 0xF6, 0xEF, 0x07, 0x07, // Code for char 0xA1
+    0x15, 0x19, 0x78, 0xF0, 0x73, 0xF8, 0xE1, 0xCC, 0x20, 0x01, // Code for char 0xA2
+    0x06, 0x18, 0x90, 0xFD, 0xFF, 0x8D, 0x18, 0x71, 0xA2, 0x40, // Code for char 0xA3
+    0x15, 0x25, 0xED, 0x2F, 0x49, 0x7F, 0x0B, // Code for char 0xA4
+    0x15, 0x18, 0x57, 0xBE, 0xE0, 0xC7, 0xFF, 0xE5, 0x0A, // Code for char 0xA5
+    0x31, 0x1A, 0x9F, 0xFF, 0x3C, // Code for char 0xA6
+    0x15, 0x0B, 0x66, 0xF4, 0xCF, 0x99, 0x99, 0x99, 0xF3, 0x2F, 0x66, // Code for char 0xA7
+    0x15, 0x01, 0x0F, 0x0F, // Code for char 0xA8
+    0x07, 0x18, 0xFE, 0x06, 0xE7, 0x2C, 0x5A, 0x34, 0xE5, 0x60, 0x7F, // Code for char 0xA9
+    0x15, 0x16, 0xC8, 0x6E, 0xB5, 0xFA, 0xF5, 0x02, // Code for char 0xAA
+    0x07, 0x54, 0xC4, 0xED, 0x48, 0xDC, 0x8E, // Code for char 0xAB
+    0x15, 0x52, 0x49, 0xF2, 0x03, // Code for char 0xAC
+    0x15, 0x50, 0x3F, // Code for char 0xAD
+    0x07, 0x18, 0xFE, 0x06, 0xF7, 0x2D, 0x59, 0x32, 0xEB, 0x60, 0x7F, // Code for char 0xAE
+    0x07, 0x00, 0xFF, // Code for char 0xAF
+    0x15, 0x03, 0xF6, 0x99, 0x6F, // Code for char 0xB0
+    0x15, 0x36, 0x44, 0xE2, 0xF7, 0x4B, 0x24, 0x02, // Code for char 0xB1
+    0x23, 0x14, 0xB9, 0x5F, 0x09, // Code for char 0xB2
+    0x23, 0x14, 0xB1, 0x7E, 0x05, // Code for char 0xB3
+    0x22, 0x01, 0x1E, // Code for char 0xB4
+    0x07, 0x29, 0x00, 0xFE, 0xFF, 0x1F, 0x10, 0x40, 0xFC, 0xF0, 0x07, 0x10, // Code for char 0xB5
+    0x16, 0x0B, 0x1C, 0xE0, 0x03, 0x7F, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0x00, // Code for char 0xB6
+    0x32, 0x41, 0x3F, // Code for char 0xB7
+    0x23, 0x92, 0xEC, 0x05, // Code for char 0xB8
+    0x22, 0x14, 0xE2, 0x7F, // Code for char 0xB9
+    0x15, 0x16, 0xCE, 0x6F, 0x34, 0xFA, 0x75, 0x02, // Code for char 0xBA
+    0x07, 0x54, 0x71, 0x3B, 0x12, 0xB7, 0x23, // Code for char 0xBB
+    0x07, 0x0A, 0x02, 0xF9, 0xCC, 0x37, 0xC0, 0x06, 0x3B, 0x6C, 0x31, 0x9F, 0xF8, // Code for char 0xBC
+    0x07, 0x0A, 0x02, 0xF9, 0xCC, 0x37, 0xC0, 0x00, 0x67, 0xAC, 0x33, 0x97, 0x90, // Code for char 0xBD
+    0x07, 0x0A, 0x11, 0xA9, 0xCC, 0x37, 0xD4, 0x06, 0x3B, 0x6C, 0x31, 0x9F, 0xF8, // Code for char 0xBE
+    0x15, 0x38, 0xC0, 0xC0, 0xEF, 0xDC, 0x08, 0x1C, 0x18, // Code for char 0xBF
+    0x15, 0x09, 0xF8, 0xF7, 0x7F, 0x84, 0x11, 0xFC, 0xE3, 0x0F, // Code for char 0xC0
+    0x15, 0x09, 0xF8, 0xF3, 0x6F, 0xC4, 0x11, 0xFD, 0xE3, 0x0F, // Code for char 0xC1
+    0x15, 0x09, 0xF8, 0xF7, 0x7F, 0xC4, 0x11, 0xFD, 0xE3, 0x0F, // Code for char 0xC2
+    0x15, 0x09, 0xF2, 0xE7, 0xDF, 0x84, 0x13, 0xFA, 0xC7, 0x0F, // Code for char 0xC3
+    0x15, 0x09, 0xF8, 0xF7, 0x6F, 0x84, 0x11, 0xFD, 0xE3, 0x0F, // Code for char 0xC4
+    0x15, 0x09, 0xF0, 0xEB, 0xDF, 0x44, 0x13, 0xFA, 0xC3, 0x0F, // Code for char 0xC5
+    0x16, 0x18, 0xF8, 0xF9, 0x9B, 0xF8, 0xFF, 0x3F, 0x62, 0x44, // Code for char 0xC6
+    0x15, 0x1A, 0x7E, 0xF8, 0x67, 0x60, 0x03, 0x7F, 0x2E, 0x33, 0x00, // Code for char 0xC7
+    0x15, 0x09, 0xFC, 0xF7, 0x5F, 0x22, 0x89, 0x24, 0x12, 0x08, // Code for char 0xC8
+    0x15, 0x09, 0xFC, 0xF3, 0x4F, 0x62, 0x89, 0x25, 0x12, 0x08, // Code for char 0xC9
+    0x15, 0x09, 0xFC, 0xF7, 0x5F, 0x62, 0x89, 0x25, 0x12, 0x08, // Code for char 0xCA
+    0x15, 0x09, 0xFC, 0xF7, 0x4F, 0x22, 0x89, 0x25, 0x12, 0x08, // Code for char 0xCB
+    0x23, 0x09, 0x01, 0xF6, 0xCF, 0x3F, 0x80, // Code for char 0xCC
+    0x23, 0x09, 0x04, 0xF2, 0xDF, 0x7F, 0x81, // Code for char 0xCD
+    0x23, 0x09, 0x05, 0xF6, 0xDF, 0x7F, 0x81, // Code for char 0xCE
+    0x23, 0x09, 0x05, 0xF2, 0xCF, 0x7F, 0x81, // Code for char 0xCF
+    0x06, 0x18, 0x10, 0xFE, 0xFF, 0x8F, 0x38, 0xD8, 0x1F, 0x1F, // Code for char 0xD0
+    0x16, 0x09, 0xFA, 0xE7, 0x1F, 0x83, 0x18, 0xC2, 0xE4, 0x8F, 0x3F, // Code for char 0xD1
+    0x15, 0x09, 0xF8, 0xF5, 0x5F, 0x20, 0x81, 0xFC, 0xE3, 0x07, // Code for char 0xD2
+    0x15, 0x09, 0xF8, 0xF1, 0x4F, 0x60, 0x81, 0xFD, 0xE3, 0x07, // Code for char 0xD3
+    0x15, 0x09, 0xF8, 0xF5, 0x5F, 0x60, 0x81, 0xFD, 0xE3, 0x07, // Code for char 0xD4
+    0x15, 0x09, 0xF8, 0xF5, 0x5F, 0x60, 0x81, 0xFD, 0xE3, 0x07, // Code for char 0xD5
+    0x15, 0x09, 0xF8, 0xF5, 0x4F, 0x20, 0x81, 0xFD, 0xE3, 0x07, // Code for char 0xD6
+    0x15, 0x26, 0x63, 0x1B, 0x87, 0x63, 0x1B, 0x03, // Code for char 0xD7
+    0x15, 0x18, 0xFE, 0xFF, 0xC7, 0xED, 0xF8, 0xFF, 0x1F, // Code for char 0xD8
+    0x15, 0x09, 0xFC, 0xF5, 0x1F, 0x20, 0x80, 0xFC, 0xF3, 0x07, // Code for char 0xD9
+    0x15, 0x09, 0xFC, 0xF1, 0x0F, 0x60, 0x80, 0xFD, 0xF3, 0x07, // Code for char 0xDA
+    0x15, 0x09, 0xFC, 0xF5, 0x1F, 0x60, 0x80, 0xFD, 0xF3, 0x07, // Code for char 0xDB
+    0x15, 0x09, 0xFC, 0xF5, 0x0F, 0x20, 0x80, 0xFD, 0xF3, 0x07, // Code for char 0xDC
+    0x15, 0x09, 0x1C, 0xF0, 0x00, 0x7E, 0xF8, 0x3D, 0x70, 0x00, // Code for char 0xDD
+    0x15, 0x18, 0xFF, 0xFF, 0x13, 0x21, 0xC2, 0x07, 0x07, // Code for char 0xDE
+    0x15, 0x18, 0xFE, 0xFF, 0x07, 0x78, 0xE8, 0x1F, 0x1E, // Code for char 0xDF
+    0x15, 0x09, 0x80, 0x25, 0xBF, 0xA4, 0x92, 0xF8, 0xC3, 0x0F, // Code for char 0xE0
+    0x15, 0x09, 0x80, 0x21, 0xAF, 0xE4, 0x92, 0xF9, 0xC3, 0x0F, // Code for char 0xE1
+    0x15, 0x09, 0x80, 0x29, 0x9F, 0x64, 0x92, 0xFA, 0xC3, 0x0F, // Code for char 0xE2
+    0x15, 0x09, 0x82, 0x25, 0x9F, 0xA4, 0x92, 0xFA, 0xC7, 0x0F, // Code for char 0xE3
+    0x15, 0x09, 0x83, 0x2D, 0x8F, 0x24, 0x92, 0xFB, 0xCF, 0x0F, // Code for char 0xE4
+    0x15, 0x09, 0x80, 0x49, 0x5F, 0x65, 0x95, 0xF2, 0x83, 0x0F, // Code for char 0xE5
+    0x07, 0x36, 0xB0, 0x7C, 0xD2, 0xFF, 0x4B, 0x3E, 0x9D, // Code for char 0xE6
+    0x15, 0x38, 0x3E, 0xFE, 0x06, 0x0D, 0x3E, 0x46, 0x04, // Code for char 0xE7
+    0x15, 0x09, 0xF0, 0xE5, 0xBF, 0xA4, 0x92, 0x78, 0xC2, 0x01, // Code for char 0xE8
+    0x15, 0x09, 0xF0, 0xE1, 0xAF, 0xE4, 0x92, 0x79, 0xC2, 0x01, // Code for char 0xE9
+    0x15, 0x09, 0xF0, 0xE9, 0x9F, 0x64, 0x92, 0x7A, 0xC2, 0x01, // Code for char 0xEA
+    0x15, 0x09, 0xF3, 0xED, 0x8F, 0x24, 0x92, 0x7B, 0xCE, 0x01, // Code for char 0xEB
+    0x15, 0x09, 0x08, 0x26, 0xB8, 0xBF, 0xFE, 0x00, 0x02, 0x08, // Code for char 0xEC
+    0x15, 0x09, 0x08, 0x22, 0xA8, 0xFF, 0xFE, 0x01, 0x02, 0x08, // Code for char 0xED
+    0x15, 0x09, 0x08, 0x2A, 0x98, 0x7F, 0xFE, 0x02, 0x02, 0x08, // Code for char 0xEE
+    0x15, 0x09, 0x0B, 0x2E, 0x88, 0x3F, 0xFE, 0x03, 0x0E, 0x08, // Code for char 0xEF
+    0x15, 0x18, 0xF4, 0xEA, 0x2F, 0x74, 0xD8, 0x3F, 0x1F, // Code for char 0xF0
+    0x15, 0x09, 0xFA, 0xE7, 0x9F, 0x80, 0x02, 0xFA, 0xC7, 0x0F, // Code for char 0xF1
+    0x15, 0x09, 0xF0, 0xE5, 0xBF, 0xA0, 0x82, 0xF8, 0xC3, 0x07, // Code for char 0xF2
+    0x15, 0x09, 0xF0, 0xE1, 0xAF, 0xE0, 0x82, 0xF9, 0xC3, 0x07, // Code for char 0xF3
+    0x15, 0x09, 0xF0, 0xE9, 0x9F, 0x60, 0x82, 0xFA, 0xC3, 0x07, // Code for char 0xF4
+    0x15, 0x09, 0xF2, 0xE5, 0x9F, 0xA0, 0x82, 0xFA, 0xC7, 0x07, // Code for char 0xF5
+    0x15, 0x09, 0xF3, 0xED, 0x8F, 0x20, 0x82, 0xFB, 0xCF, 0x07, // Code for char 0xF6
+    0x15, 0x26, 0x08, 0xC4, 0x7A, 0x8D, 0x40, 0x00, // Code for char 0xF7
+    0x15, 0x36, 0xFE, 0x7F, 0xB6, 0xF9, 0xFF, 0x01, // Code for char 0xF8
+    0x15, 0x09, 0xF8, 0xE5, 0x3F, 0xA0, 0x80, 0xF8, 0xE3, 0x0F, // Code for char 0xF9
+    0x15, 0x09, 0xF8, 0xE1, 0x2F, 0xE0, 0x80, 0xF9, 0xE3, 0x0F, // Code for char 0xFA
+    0x15, 0x09, 0xFA, 0xED, 0x1F, 0x60, 0x80, 0xFB, 0xEB, 0x0F, // Code for char 0xFB
+    0x15, 0x09, 0xFB, 0xED, 0x0F, 0x20, 0x80, 0xFB, 0xEF, 0x0F, // Code for char 0xFC
+    0x06, 0x0B, 0x00, 0x88, 0x8F, 0xF8, 0x29, 0xD0, 0x03, 0x97, 0x3F, 0xF8, 0x00, // Code for char 0xFD
+    0x15, 0x0B, 0xFF, 0xFF, 0xFF, 0x08, 0x81, 0x10, 0xF8, 0x01, 0x0F, // Code for char 0xFE
+    0x06, 0x0B, 0x00, 0xB8, 0x8F, 0xFB, 0x09, 0xD0, 0x00, 0xB7, 0x3F, 0xFB, 0x00 // Code for char 0xFF
+};
+
+///
+/// @brief Offsets of characters 32, 48, 64... in Terminal8x12p
+///
+static const uint16_t Terminal8x12pIndex[14] =
+{
+    0, 109, 242, 388, 523, 658, 788, 858, 903, 1015, 1140, 1289, 1445, 1603
+};
+
+#endif // TERMINAL8P_FONT_RELEASE
@@ -631,8 +631,12 @@ const pins_t boardTeensy3x =
 /// * Commercial edition: self and virtual options
 /// @note Recommended: USE_hV_SCREEN_VIRTUAL
 /// @warning Issues with virtual function on arm-none-eabi-g++ 4.9.3: use USE_hV_SCREEN_SELF instead.
+/// @note USE_hV_SCREEN_STATIC binds line(), circle(), triangle() and gText()
+/// to the screen at compile time, see hV_Screen_Static.h
+/// @n Recommended for small MCUs as Cortex-M0+, where calls dominate drawing.
 /// @{
 #define USE_hV_SCREEN_SELF 2 ///< Do not use virtual object
+#define USE_hV_SCREEN_STATIC 3 ///< Use template object, bound at compile time
 
 #define USE_hV_SCREEN USE_hV_SCREEN_SELF ///< Selected option
 /// @}
@@ -699,4 +703,161 @@ const pins_t boardTeensy3x =
 #define STORAGE_MODE USE_NONE ///< Selected options
 /// @}
 
+///
+/// @brief 12- Set dirty map mode
+/// @details Record which tiles of the frame-buffer changed since last flush()
+/// * USE_DIRTY_NONE: no dirty map
+/// * USE_DIRTY_TILES: tiles of 8 bytes by 8 rows, 1 bit per tile
+/// @n Dirty map requires ~180 bytes for 11.98"
+///
+/// @{
+#define USE_DIRTY_NONE 0 ///< No dirty map
+#define USE_DIRTY_TILES 1 ///< Tiles of 8 bytes by 8 rows
+
+#define DIRTY_MODE USE_DIRTY_NONE ///< Selected option
+/// @}
+
+///
+/// @brief 13- Set glyph atlas
+/// @details Cache of Terminal glyphs transposed into rows of pixels,
+/// for the orientations where the columns of the fonts cross the bytes of the frame-buffer
+/// * GLYPH_ATLAS_SIZE: number of glyphs, least recently used evicted
+/// * 0: no atlas, glyphs transposed at each call
+/// @n Glyph atlas requires 52 bytes per glyph, ~830 bytes for 16 glyphs
+///
+/// @{
+#define GLYPH_ATLAS_SIZE 0 ///< Selected option, eg. 16
+/// @}
+
+///
+/// @brief 14- Set Terminal fonts transposed at compilation
+/// @details Terminal fonts as rows of pixels, generated from the tables of columns with constexpr,
+/// for the orientations where the columns of the fonts cross the bytes of the frame-buffer
+/// * FONT_ROWS_ORIENTATIONS: bit n set for orientation n, eg. 0x05 for orientations 0 and 2
+/// * 0x00: no tables, glyph atlas or transpose at run-time
+/// @note With Screen_EPD_EXT3, orientations 0 and 2 share the same tables,
+/// orientations 1 and 3 use the tables of columns
+/// @n Tables require ~22 kB of Flash for the 4 sizes, no RAM
+///
+/// @{
+#define FONT_ROWS_ORIENTATIONS 0x00 ///< Selected option
+/// @}
+
+///
+/// @brief 15- Set proportional Terminal fonts
+/// @details Widths of the Terminal glyphs, generated from the tables of columns with constexpr
+/// * USE_PROPORTIONAL_WIDTHS: setFontProportional() and setFontKerning() available
+/// @n Widths require ~3.5 kB of Flash for the 4 sizes, no RAM
+///
+/// @{
+#define USE_PROPORTIONAL_NONE 0 ///< Monospaced fonts only
+#define USE_PROPORTIONAL_WIDTHS 1 ///< Widths tables
+
+#define PROPORTIONAL_MODE USE_PROPORTIONAL_WIDTHS ///< Selected option
+/// @}
+
+///
+/// @brief 16- Set storage of Terminal fonts
+/// @details Terminal fonts as tables of columns or as packed bitstreams
+/// * USE_FONT_COLUMNS: tables of columns, ~21 kB of Flash for the 4 sizes
+/// * USE_FONT_PACKED: blank columns and rows skipped, ~11 kB of Flash for the 4 sizes
+/// @n Packed glyphs are decoded by blocks of 8 columns, without RAM copy of the glyph
+/// @note USE_FONT_PACKED doesn't use the glyph atlas nor the fonts transposed at compilation,
+/// set GLYPH_ATLAS_SIZE to 0 and FONT_ROWS_ORIENTATIONS to 0x00
+///
+/// @{
+#define USE_FONT_COLUMNS 0 ///< Tables of columns
+#define USE_FONT_PACKED 1 ///< Packed bitstreams
+
+#define FONT_STORAGE USE_FONT_COLUMNS ///< Selected option
+/// @}
+
+///
+/// @brief 17- Set buffer for formatted text
+/// @details gTextf() formats the text into a buffer on the stack, no heap allocation
+/// * TEXT_BUFFER_SIZE: size in bytes, terminating null included, longer text truncated
+///
+/// @{
+#define TEXT_BUFFER_SIZE 64 ///< Selected option
+/// @}
+
+///
+/// @brief 18- Set text fields
+/// @details Text fields remember the displayed characters, redrawn only when changed
+/// * TEXT_FIELD_SIZE: maximum number of characters per field
+/// @n Each field requires TEXT_FIELD_SIZE + 12 bytes of RAM
+///
+/// @{
+#define TEXT_FIELD_SIZE 16 ///< Selected option
+/// @}
+
+///
+/// @brief 19- Set SPI transfer of frame data
+/// @details Data sent after the register index, including the frames
+/// * USE_SPI_BYTE: byte by byte with SPI.transfer(uint8_t)
+/// * USE_SPI_BULK: SPI.writeBytes() on ESP32 and ESP8266, SPI.transfer(buffer, 0, size) on RP2040,
+/// otherwise SPI.transfer(buffer, size) on chunks of SPI_CHUNK_SIZE bytes copied on the stack
+/// @note Same bytes sent on the bus with both options
+///
+/// @{
+#define USE_SPI_BYTE 0 ///< Byte by byte
+#define USE_SPI_BULK 1 ///< Bulk transfers
+
+#define SPI_TRANSFER_MODE USE_SPI_BULK ///< Selected option
+#define SPI_CHUNK_SIZE 64 ///< Chunk for generic bulk transfers, bytes
+/// @}
+
+///
+/// @brief 20- Set wait for BUSY
+/// @details Wait for the panel during flush(), with timeout
+/// * USE_BUSY_POLLING: digitalRead() between calls to the hook set by setBusyWait(), or delay(BUSY_POLL_PERIOD)
+/// * USE_BUSY_INTERRUPT: rising edge of BUSY caught by interrupt, the hook may sleep until then
+/// * BUSY_INTERRUPT_SLOTS: screens waiting at the same time by interrupt, 1 or 2, others polling
+/// * BUSY_TIMEOUT: default timeout, ms, see getUpdateResult()
+/// @note flushAsync() polls BUSY from poll(), with the same timeout
+///
+/// @{
+#define USE_BUSY_POLLING 0 ///< Polling
+#define USE_BUSY_INTERRUPT 1 ///< Interrupt on rising edge
+
+#define BUSY_WAIT_MODE USE_BUSY_POLLING ///< Selected option
+#define BUSY_POLL_PERIOD 1 ///< Period without hook, ms
+#define BUSY_INTERRUPT_SLOTS 2 ///< Screens waiting by interrupt
+#define BUSY_TIMEOUT 30000 ///< Default timeout, ms
+/// @}
+
+///
+/// @brief 21- Set prediction of refresh duration
+/// @details Busy durations of Display Refresh and DC-DC off learnt per temperature band
+/// * USE_PREDICTION_NONE: BUSY polled all along
+/// * USE_PREDICTION_AVERAGE: moving average, delay() until PREDICTION_MARGIN % before predicted end, then BUSY polled
+/// * PREDICTION_BANDS: bands of 10 °C from -15 °C, the last one open
+/// * PREDICTION_WEIGHT: new duration counts for 1 / PREDICTION_WEIGHT
+/// @note Learnt by each screen, not kept across resets
+///
+/// @{
+#define USE_PREDICTION_NONE 0 ///< No prediction
+#define USE_PREDICTION_AVERAGE 1 ///< Exponential moving average
+
+#define REFRESH_PREDICTION USE_PREDICTION_AVERAGE ///< Selected option
+#define PREDICTION_BANDS 8 ///< Temperature bands
+#define PREDICTION_WEIGHT 4 ///< Weight of the moving average
+#define PREDICTION_MARGIN 5 ///< Polling before predicted end, %
+/// @}
+
+///
+/// @brief 22- Set writing of control pins
+/// @details DC, CS and CSS pins toggled for each command
+/// * USE_FAST_PIN_DIGITAL: digitalWrite()
+/// * USE_FAST_PIN_REGISTER: set and clear registers, resolved once by begin()
+/// @note USE_FAST_PIN_REGISTER for ESP32, ESP8266, RP2040, SAMD and nRF52 Adafruit,
+/// digitalWrite() otherwise
+///
+/// @{
+#define USE_FAST_PIN_DIGITAL 0 ///< digitalWrite()
+#define USE_FAST_PIN_REGISTER 1 ///< Port registers
+
+#define FAST_PIN_MODE USE_FAST_PIN_REGISTER ///< Selected option
+/// @}
+
 #endif // hV_CONFIGURATION_RELEASE
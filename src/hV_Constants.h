@@ -116,6 +116,36 @@
 /// @}
 ///
 
+///
+/// @brief Bitmap formats
+/// @note Numbers are bit-based and or-combinable
+/// @{
+#define BITMAP_ROW 0x00 ///< Row-major, consecutive bytes along x-axis, default
+#define BITMAP_COLUMN 0x01 ///< Column-major, consecutive bytes along y-axis
+#define BITMAP_MSB 0x00 ///< First pixel on bit 7, Adafruit GFX, default
+#define BITMAP_LSB 0x02 ///< First pixel on bit 0, XBM
+/// @}
+
+///
+/// @brief Bitmap modes
+/// @note Numbers are sequential and exclusive
+/// @{
+#define BITMAP_OPAQUE 0x00 ///< Set and clear pixels drawn
+#define BITMAP_TRANSPARENT 0x01 ///< Set pixels drawn only
+#define BITMAP_MASKED 0x02 ///< Pixels drawn where the mask is set
+/// @}
+
+///
+/// @brief Text box options
+/// @note Alignments are sequential and exclusive, TEXT_ELLIPSIS is or-combinable
+/// @{
+#define TEXT_ALIGN_LEFT 0x00 ///< Lines aligned on left, default
+#define TEXT_ALIGN_CENTER 0x01 ///< Lines centered
+#define TEXT_ALIGN_RIGHT 0x02 ///< Lines aligned on right
+#define TEXT_ALIGN_MASK 0x03 ///< Mask for alignment
+#define TEXT_ELLIPSIS 0x04 ///< Last line ended with … if the text doesn't fit
+/// @}
+
 ///
 /// @brief Orientation constants
 /// @{
@@ -96,6 +96,49 @@ struct font_s
     uint8_t number; ///< number of characters, usually 96 or 224
 };
 
+///
+/// @brief Structure for kerning pair
+/// @note Tables sorted by first character, then by second character
+///
+struct kerning_s
+{
+    uint8_t first; ///< left character
+    uint8_t second; ///< right character
+    int8_t offset; ///< horizontal adjustment in pixels, negative = closer
+};
+
+///
+/// @brief Structure for codepoint of character
+/// @note Tables sorted by codepoint
+///
+struct codepoint_s
+{
+    uint16_t codepoint; ///< Unicode codepoint
+    uint8_t character; ///< character in font
+};
+
+/// @cond
+///
+/// @brief Sequence 0..N-1, for tables generated at compilation
+/// @note C++11 compatible
+///
+template <uint16_t... I>
+struct _f_sequence_s
+{
+};
+
+template <uint16_t N, uint16_t... I>
+struct _f_makeSequence : _f_makeSequence < N - 1, N - 1, I... >
+{
+};
+
+template <uint16_t... I>
+struct _f_makeSequence<0, I...>
+{
+    typedef _f_sequence_s<I...> type;
+};
+/// @endcond
+
 #endif // USE_FONT_TERMINAL
 
 #endif // hV_FONT_HEADER_STRUCTURE_RELEASE
@@ -23,9 +23,43 @@
 #include "hV_Font_Terminal.h"
 //#include "hV_Utilities.h"
 
+#if (FONT_STORAGE == USE_FONT_PACKED)
+#if (MAX_FONT_SIZE > 0)
+#include "Terminal6x8p.h"
+#if (MAX_FONT_SIZE > 1)
+#include "Terminal8x12p.h"
+#if (MAX_FONT_SIZE > 2)
+#include "Terminal12x16p.h"
+#if (MAX_FONT_SIZE > 3)
+#include "Terminal16x24p.h"
+#endif // end MAX_FONT_SIZE > 3
+#endif // end MAX_FONT_SIZE > 2
+#endif // end MAX_FONT_SIZE > 1
+#endif // end MAX_FONT_SIZE > 0
+#endif // FONT_STORAGE
+
+#if (FONT_ROWS_ORIENTATIONS > 0)
+#include "hV_Font_Terminal_Rows.h"
+#endif // FONT_ROWS_ORIENTATIONS
+
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+#include "hV_Font_Terminal_Widths.h"
+#endif // PROPORTIONAL_MODE
+
 // The Arduino IDE doesn't allow to select the libraries, hence this condition.
 #if (FONT_MODE == USE_FONT_TERMINAL)
 
+// Windows-1252 characters 0x80..0x9f, sorted by codepoint
+static const codepoint_s _f_codepoints[] =
+{
+    { 0x0152, 0x8c }, { 0x0153, 0x9c }, { 0x0160, 0x8a }, { 0x0161, 0x9a }, { 0x0178, 0x9f },
+    { 0x017d, 0x8e }, { 0x017e, 0x9e }, { 0x0192, 0x83 }, { 0x02c6, 0x88 }, { 0x02dc, 0x98 },
+    { 0x2013, 0x96 }, { 0x2014, 0x97 }, { 0x2018, 0x91 }, { 0x2019, 0x92 }, { 0x201a, 0x82 },
+    { 0x201c, 0x93 }, { 0x201d, 0x94 }, { 0x201e, 0x84 }, { 0x2020, 0x86 }, { 0x2021, 0x87 },
+    { 0x2022, 0x95 }, { 0x2026, 0x85 }, { 0x2030, 0x89 }, { 0x2039, 0x8b }, { 0x203a, 0x9b },
+    { 0x20ac, 0x80 }, { 0x2122, 0x99 }
+};
+
 // Code
 // Font functions
 //hV_Font_Terminal::hV_Font_Terminal()
@@ -35,6 +69,13 @@ void hV_Font_Terminal::_f_begin()
     _f_fontNumber     = MAX_FONT_SIZE;
     _f_fontSolid      = true;
     _f_fontSpaceX     = 1;
+    _f_fontSpaceY     = 1;
+    _f_fontScale      = 1;
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    _f_fontProportional = false;
+    _f_fontKerning = 0;
+    _f_fontKerningNumber = 0;
+#endif // PROPORTIONAL_MODE
 
     // Take first font
     _f_selectFont(0);
@@ -83,6 +124,72 @@ void hV_Font_Terminal::_f_selectFont(uint8_t size)
         default:
             break;
     }
+
+#if (FONT_STORAGE == USE_FONT_PACKED)
+    switch (_f_fontSize)
+    {
+#if (MAX_FONT_SIZE > 0)
+        case 0:
+            _f_fontPacked = Terminal6x8p;
+            _f_fontPackedIndex = Terminal6x8pIndex;
+            break;
+#endif // end MAX_FONT_SIZE > 0
+#if (MAX_FONT_SIZE > 1)
+        case 1:
+            _f_fontPacked = Terminal8x12p;
+            _f_fontPackedIndex = Terminal8x12pIndex;
+            break;
+#endif // end MAX_FONT_SIZE > 1
+#if (MAX_FONT_SIZE > 2)
+        case 2:
+            _f_fontPacked = Terminal12x16p;
+            _f_fontPackedIndex = Terminal12x16pIndex;
+            break;
+#endif // end MAX_FONT_SIZE > 2
+#if (MAX_FONT_SIZE > 3)
+        case 3:
+            _f_fontPacked = Terminal16x24p;
+            _f_fontPackedIndex = Terminal16x24pIndex;
+            break;
+#endif // end MAX_FONT_SIZE > 3
+        default:
+            break;
+    }
+#endif // FONT_STORAGE
+
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    switch (_f_fontSize)
+    {
+#if (MAX_FONT_SIZE > 0)
+        case 0:
+            _f_fontWidths = Terminal6x8w.width;
+            break;
+#endif // end MAX_FONT_SIZE > 0
+#if (MAX_FONT_SIZE > 1)
+        case 1:
+            _f_fontWidths = Terminal8x12w.width;
+            break;
+#endif // end MAX_FONT_SIZE > 1
+#if (MAX_FONT_SIZE > 2)
+        case 2:
+            _f_fontWidths = Terminal12x16w.width;
+            break;
+#endif // end MAX_FONT_SIZE > 2
+#if (MAX_FONT_SIZE > 3)
+        case 3:
+            _f_fontWidths = Terminal16x24w.width;
+            break;
+#endif // end MAX_FONT_SIZE > 3
+        default:
+            break;
+    }
+
+    // Monospace bit of font kind
+    if (_f_fontProportional)
+    {
+        _f_font.kind &= ~0x40;
+    }
+#endif // PROPORTIONAL_MODE
 }
 
 uint8_t hV_Font_Terminal::_f_fontMax()
@@ -100,8 +207,130 @@ void hV_Font_Terminal::_f_setFontSpaceY(uint8_t number)
     _f_fontSpaceY = number;
 }
 
+void hV_Font_Terminal::_f_setFontScale(uint8_t scale)
+{
+    _f_fontScale = (uint8_t)checkRange(scale, 1, 4);
+}
+
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+void hV_Font_Terminal::_f_setFontProportional(bool flag)
+{
+    _f_fontProportional = flag;
+    if (_f_fontProportional)
+    {
+        _f_font.kind &= ~0x40;
+    }
+    else
+    {
+        _f_font.kind |= 0x40;
+    }
+}
+
+void hV_Font_Terminal::_f_setFontKerning(const kerning_s * table, uint16_t number)
+{
+    _f_fontKerning = table;
+    _f_fontKerningNumber = (table == 0) ? 0 : number;
+}
+
+int8_t hV_Font_Terminal::_f_getKerning(uint8_t first, uint8_t second)
+{
+    uint16_t key = ((uint16_t)first << 8) | second;
+    uint16_t low = 0;
+    uint16_t high = _f_fontKerningNumber;
+
+    while (low < high)
+    {
+        uint16_t middle = (low + high) >> 1;
+        uint16_t value = ((uint16_t)_f_fontKerning[middle].first << 8) | _f_fontKerning[middle].second;
+
+        if (value == key)
+        {
+            return _f_fontKerning[middle].offset;
+        }
+        else if (value < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return 0;
+}
+#endif // PROPORTIONAL_MODE
+
+uint8_t hV_Font_Terminal::_f_getCode(uint32_t codepoint)
+{
+    // ISO-8859-1, or byte of string converted with utf2iso()
+    if ((codepoint >= _f_font.first) and (codepoint < (uint32_t)_f_font.first + _f_font.number))
+    {
+        return (uint8_t)codepoint;
+    }
+
+    uint16_t low = 0;
+    uint16_t high = sizeof(_f_codepoints) / sizeof(_f_codepoints[0]);
+
+    while (low < high)
+    {
+        uint16_t middle = (low + high) >> 1;
+
+        if (_f_codepoints[middle].codepoint == codepoint)
+        {
+            return _f_codepoints[middle].character;
+        }
+        else if (_f_codepoints[middle].codepoint < codepoint)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return '?';
+}
+
+int16_t hV_Font_Terminal::_f_getAdvanceX(uint8_t character, uint8_t previous)
+{
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    if (_f_fontProportional)
+    {
+        int16_t result = _f_fontWidths[(uint8_t)(character - _f_font.first)].pixel + _f_fontSpaceX;
+        if ((previous > 0) and (_f_fontKerningNumber > 0))
+        {
+            result += _f_getKerning(previous, character);
+        }
+        return result * _f_fontScale;
+    }
+#else
+    (void)character; // unused
+    (void)previous; // unused
+#endif // PROPORTIONAL_MODE
+
+    // Monospaced font, spacing included
+    return _f_font.maxWidth * _f_fontScale;
+}
+
 uint8_t hV_Font_Terminal::_f_getCharacter(uint8_t character, uint16_t index)
 {
+#if (FONT_STORAGE == USE_FONT_PACKED)
+    uint8_t bytes = (_f_font.height + 7) >> 3;
+    uint8_t column = index / bytes;
+    stream_s stream;
+    uint32_t value = 0;
+
+    _f_openPacked(character, stream);
+    if ((column < stream.first) or (column >= stream.first + stream.columns))
+    {
+        return 0;
+    }
+    for (uint8_t i = stream.first; i <= column; i++)
+    {
+        value = _f_readPacked(stream);
+    }
+    return (uint8_t)(value >> (8 * (index % bytes)));
+#else
 #if (MAX_FONT_SIZE > 0)
     if (_f_fontSize == 0)
     {
@@ -130,39 +359,276 @@ uint8_t hV_Font_Terminal::_f_getCharacter(uint8_t character, uint16_t index)
         return 0;
     }
 #endif // end MAX_FONT_SIZE > 0
+#endif // FONT_STORAGE
+}
+
+const uint8_t * hV_Font_Terminal::_f_getCharacterTable()
+{
+#if (FONT_STORAGE == USE_FONT_PACKED)
+    return 0;
+#else
+#if (MAX_FONT_SIZE > 0)
+    if (_f_fontSize == 0)
+    {
+        return &Terminal6x8e[0][0];
+    }
+#if (MAX_FONT_SIZE > 1)
+    else if (_f_fontSize == 1)
+    {
+        return &Terminal8x12e[0][0];
+    }
+#if (MAX_FONT_SIZE > 2)
+    else if (_f_fontSize == 2)
+    {
+        return &Terminal12x16e[0][0];
+    }
+#if (MAX_FONT_SIZE > 3)
+    else if (_f_fontSize == 3)
+    {
+        return &Terminal16x24e[0][0];
+    }
+#endif // end MAX_FONT_SIZE > 3
+#endif // end MAX_FONT_SIZE > 2
+#endif // end MAX_FONT_SIZE > 1
+    else
+    {
+        return 0;
+    }
+#endif // end MAX_FONT_SIZE > 0
+#endif // FONT_STORAGE
+}
+
+#if (FONT_STORAGE == USE_FONT_PACKED)
+void hV_Font_Terminal::_f_openPacked(uint8_t character, stream_s & stream)
+{
+    const uint8_t * data = _f_fontPacked + _f_fontPackedIndex[character >> 4];
+    bool flagWide = (_f_font.height > 16); // 3-byte header
+
+    // First character of the group of 16, then next ones
+    for (uint16_t i = character & 0xf0; i <= character; i++)
+    {
+        uint8_t header = 1;
+        uint16_t size = 0;
+
+        if (data[0] == 0xff)
+        {
+            stream.first = 0;
+            stream.columns = 0;
+            stream.top = 0;
+            stream.rows = 0;
+        }
+        else
+        {
+            stream.first = data[0] >> 4;
+            stream.columns = (data[0] & 0x0f) + 1;
+            if (flagWide)
+            {
+                stream.top = data[1];
+                stream.rows = data[2];
+                header = 3;
+            }
+            else
+            {
+                stream.top = data[1] >> 4;
+                stream.rows = (data[1] & 0x0f) + 1;
+                header = 2;
+            }
+            size = ((uint16_t)stream.columns * stream.rows + 7) >> 3;
+        }
+
+        stream.data = data + header;
+        data += header + size;
+    }
+
+    stream.bits = 0;
+    stream.count = 0;
+}
+
+uint32_t hV_Font_Terminal::_f_readPacked(stream_s & stream)
+{
+    while (stream.count < stream.rows)
+    {
+        stream.bits |= (uint32_t)(*stream.data) << stream.count;
+        stream.data++;
+        stream.count += 8;
+    }
+
+    uint32_t value = stream.bits & (((uint32_t)1 << stream.rows) - 1);
+    stream.bits >>= stream.rows;
+    stream.count -= stream.rows;
+    return value << stream.top;
+}
+#endif // FONT_STORAGE
+
+#if (FONT_ROWS_ORIENTATIONS > 0)
+const uint8_t * hV_Font_Terminal::_f_getCharacterRows()
+{
+#if (MAX_FONT_SIZE > 0)
+    if (_f_fontSize == 0)
+    {
+        return &Terminal6x8r.glyph[0].data[0];
+    }
+#if (MAX_FONT_SIZE > 1)
+    else if (_f_fontSize == 1)
+    {
+        return &Terminal8x12r.glyph[0].data[0];
+    }
+#if (MAX_FONT_SIZE > 2)
+    else if (_f_fontSize == 2)
+    {
+        return &Terminal12x16r.glyph[0].data[0];
+    }
+#if (MAX_FONT_SIZE > 3)
+    else if (_f_fontSize == 3)
+    {
+        return &Terminal16x24r.glyph[0].data[0];
+    }
+#endif // end MAX_FONT_SIZE > 3
+#endif // end MAX_FONT_SIZE > 2
+#endif // end MAX_FONT_SIZE > 1
+    else
+    {
+        return 0;
+    }
+#endif // end MAX_FONT_SIZE > 0
 }
+#endif // FONT_ROWS_ORIENTATIONS
 
 uint16_t hV_Font_Terminal::_f_characterSizeX(uint8_t character)
 {
-    return _f_font.maxWidth;
+    if (character < _f_font.first)
+    {
+        return _f_font.maxWidth * _f_fontScale;
+    }
+    return _f_getAdvanceX(character);
 }
 
 uint16_t hV_Font_Terminal::_f_characterSizeY()
 {
-    return _f_font.height;
+    return _f_font.height * _f_fontScale;
 }
 
-uint16_t hV_Font_Terminal::_f_stringSizeX(String text)
+uint16_t hV_Font_Terminal::_f_stringSizeX(const char * text, uint16_t length)
 {
-    return (uint16_t) text.length() * _f_font.maxWidth;
+    int32_t result = 0;
+    uint8_t previous = 0;
+    uint16_t index = 0;
+
+    while (index < length)
+    {
+        uint8_t character = _f_getCode(decodeUTF8(text, length, index));
+        result += _f_getAdvanceX(character, previous);
+        previous = character;
+    }
+    return (result > 0) ? (uint16_t)result : 0;
 }
 
-uint8_t hV_Font_Terminal::_f_stringLengthToFitX(String text, uint16_t pixels)
+uint16_t hV_Font_Terminal::_f_stringLengthToFitX(const char * text, uint16_t length, uint16_t pixels)
 {
-    uint8_t index = 0;
+    int32_t result = 0;
+    uint8_t previous = 0;
+    uint16_t index = 0;
 
-    // Monospaced font
-    index = pixels / _f_font.maxWidth - 1;
-    if (index > text.length())
+    // Characters fully inside the pixels
+    while (index < length)
     {
-        index = text.length();
+        uint16_t next = index;
+        uint8_t character = _f_getCode(decodeUTF8(text, length, next));
+        result += _f_getAdvanceX(character, previous);
+        if (result > pixels)
+        {
+            break;
+        }
+        previous = character;
+        index = next;
     }
     return index;
 }
 
+uint16_t hV_Font_Terminal::_f_getLineBreak(const char * text, uint16_t length, uint16_t pixels, uint16_t & next, uint16_t & width)
+{
+    int32_t result = 0;
+    uint8_t previous = 0;
+    uint16_t index = 0;
+
+    // Last break, before spaces after a word
+    bool flagWord = false;
+    bool flagBreak = false;
+    uint16_t breakEnd = 0;
+    uint16_t breakNext = 0;
+    int32_t breakWidth = 0;
+
+    while (index < length)
+    {
+        // Forced break
+        if (text[index] == '\n')
+        {
+            next = index + 1;
+            width = result;
+            return index;
+        }
+
+        uint16_t following = index;
+        uint8_t character = _f_getCode(decodeUTF8(text, length, following));
+        int16_t advance = _f_getAdvanceX(character, previous);
+
+        if (character == ' ')
+        {
+            if (flagWord)
+            {
+                if (previous != ' ')
+                {
+                    breakEnd = index;
+                    breakWidth = result;
+                }
+                breakNext = following;
+                flagBreak = true;
+            }
+        }
+        else if (result + advance > pixels)
+        {
+            if (flagBreak)
+            {
+                // Break between words
+                next = breakNext;
+                width = breakWidth;
+                return breakEnd;
+            }
+
+            // Break inside word too long for the line, at least one character per line
+            uint16_t end = (index > 0) ? index : following;
+            width = (index > 0) ? result : advance;
+
+            // Spaces and LF skipped at start of next line
+            next = end;
+            while ((next < length) and (text[next] == ' '))
+            {
+                next++;
+            }
+            if ((next < length) and (text[next] == '\n'))
+            {
+                next++;
+            }
+            return end;
+        }
+        else
+        {
+            flagWord = true;
+        }
+
+        result += advance;
+        previous = character;
+        index = following;
+    }
+
+    next = length;
+    width = (result > 0) ? (uint16_t)result : 0;
+    return length;
+}
+
 uint8_t hV_Font_Terminal::_f_getFontKind()
 {
-    return _f_font.kind; // monospaced
+    return _f_font.kind; // monospaced, unless proportional
 }
 uint8_t hV_Font_Terminal::_f_getFontMaxWidth()
 {
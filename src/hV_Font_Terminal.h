@@ -76,6 +76,22 @@ enum fontNumber_e
     Font_Terminal16x24,
 };
 
+#if (FONT_STORAGE == USE_FONT_PACKED)
+///
+/// @brief Structure for packed glyph, read column by column
+///
+struct stream_s
+{
+    const uint8_t * data; ///< next byte of bitstream
+    uint32_t bits; ///< bits read, next bit on LSB
+    uint8_t count; ///< number of bits read
+    uint8_t first; ///< first column with set pixels
+    uint8_t columns; ///< number of columns with set pixels, 0 = blank
+    uint8_t top; ///< first row with set pixels
+    uint8_t rows; ///< number of rows with set pixels
+};
+#endif // FONT_STORAGE
+
 ///
 /// @brief Class for font as header file
 ///
@@ -126,6 +142,55 @@ class hV_Font_Terminal
     ///
     void _f_setFontSpaceY(uint8_t number = 1);
 
+    ///
+    /// @brief Set scale of text
+    /// @param scale 1..4, default = 1
+    /// @note Sizes and spaces are multiplied by scale
+    ///
+    void _f_setFontScale(uint8_t scale = 1);
+
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    ///
+    /// @brief Set proportional or monospaced text
+    /// @param flag default = true = proportional, false = monospaced
+    /// @note Proportional text uses the columns with set pixels, plus setSpaceX()
+    ///
+    void _f_setFontProportional(bool flag = true);
+
+    ///
+    /// @brief Set kerning pairs for proportional text
+    /// @param table kerning pairs, sorted by first then second character, 0 = none
+    /// @param number number of kerning pairs
+    /// @note The table is not copied
+    ///
+    void _f_setFontKerning(const kerning_s * table, uint16_t number);
+
+    ///
+    /// @brief Get kerning between two characters
+    /// @param first left character
+    /// @param second right character
+    /// @return horizontal adjustment in pixels, 0 if none
+    /// @note Binary search on the kerning pairs
+    ///
+    int8_t _f_getKerning(uint8_t first, uint8_t second);
+#endif // PROPORTIONAL_MODE
+
+    ///
+    /// @brief Get character in font for Unicode codepoint
+    /// @param codepoint Unicode codepoint
+    /// @return character 32~255, '?' if none
+    /// @note ISO-8859-1 directly, Windows-1252 0x80..0x9f by binary search on codepoints
+    ///
+    uint8_t _f_getCode(uint32_t codepoint);
+
+    ///
+    /// @brief Horizontal advance of character
+    /// @param character character 32~255
+    /// @param previous previous character, 0 = none
+    /// @return advance in pixels, with setSpaceX() and kerning for proportional text
+    ///
+    int16_t _f_getAdvanceX(uint8_t character, uint8_t previous = 0);
+
     ///
     /// @brief Character size, x-axis
     /// @param character character to evaluate, default=0=font general size
@@ -147,20 +212,36 @@ class hV_Font_Terminal
 
     ///
     /// @brief String size, x-axis
-    /// @param text string to evaluate
+    /// @param text UTF-8 string to evaluate
+    /// @param length length of text, in bytes
     /// @return horizontal size of the string for current font, in pixels
     /// @n @b More: @ref Fonts
     ///
-    uint16_t _f_stringSizeX(String text);
+    uint16_t _f_stringSizeX(const char * text, uint16_t length);
 
     ///
     /// @brief Number of characters to fit a size, x-axis
-    /// @param text string to evaluate
+    /// @param text UTF-8 string to evaluate
+    /// @param length length of text, in bytes
     /// @param pixels number of pixels to fit in
-    /// @return number of characters to be displayed inside the pixels
+    /// @return number of bytes of the characters to be displayed inside the pixels
+    /// @note Same as number of characters for ASCII
     /// @n @b More: @ref Fonts
     ///
-    uint8_t _f_stringLengthToFitX(String text, uint16_t pixels);
+    uint16_t _f_stringLengthToFitX(const char * text, uint16_t length, uint16_t pixels);
+
+    ///
+    /// @brief Break line of text, x-axis
+    /// @param text UTF-8 string to evaluate
+    /// @param length length of text, in bytes
+    /// @param pixels width of line, in pixels
+    /// @param[out] next index of first byte of next line
+    /// @param[out] width width of line, in pixels
+    /// @return number of bytes of the line to be displayed
+    /// @note Break after last word fitting in the line, inside a word longer than the line, or on LF.
+    /// @n Single pass, text measured and broken together
+    ///
+    uint16_t _f_getLineBreak(const char * text, uint16_t length, uint16_t pixels, uint16_t & next, uint16_t & width);
 
     ///
     /// @brief Number of fonts
@@ -191,6 +272,42 @@ class hV_Font_Terminal
     ///
     uint8_t _f_getCharacter(uint8_t character, uint16_t index);
 
+    ///
+    /// @brief Get table of characters for selected font
+    /// @return pointer to first column of character 32, 0 if none or packed
+    /// @note Each character has maxWidth columns of (height + 7) / 8 bytes,
+    /// top row as bit 0 of first byte
+    ///
+    const uint8_t * _f_getCharacterTable();
+
+#if (FONT_STORAGE == USE_FONT_PACKED)
+    ///
+    /// @brief Open packed character for selected font
+    /// @param character character 0~223, from 32~255
+    /// @param[out] stream glyph, ready for _f_readPacked()
+    /// @note Skips up to 15 characters from the index of the group of 16
+    ///
+    void _f_openPacked(uint8_t character, stream_s & stream);
+
+    ///
+    /// @brief Read next column of packed character
+    /// @param stream glyph, from _f_openPacked()
+    /// @return column, top row as bit 0
+    /// @note Only stream.columns columns, from stream.first, are available
+    ///
+    uint32_t _f_readPacked(stream_s & stream);
+#endif // FONT_STORAGE
+
+#if (FONT_ROWS_ORIENTATIONS > 0)
+    ///
+    /// @brief Get table of characters for selected font, transposed at compilation
+    /// @return pointer to first row of character 32, 0 if none
+    /// @note Each character has height rows of (maxWidth + 7) / 8 bytes,
+    /// left column as bit 7 of first byte
+    ///
+    const uint8_t * _f_getCharacterRows();
+#endif // FONT_ROWS_ORIENTATIONS
+
     ///
     /// @name Variables for font management
     /// @{
@@ -201,6 +318,17 @@ class hV_Font_Terminal
     uint8_t _f_fontSpaceX; ///< pixels between two characters, horizontal axis
     uint8_t _f_fontSpaceY; ///< pixels between two characters, vertical axis
     bool _f_fontSolid; ///<
+    uint8_t _f_fontScale; ///< scale, 1..4
+#if (FONT_STORAGE == USE_FONT_PACKED)
+    const uint8_t * _f_fontPacked; ///< packed characters for actual font
+    const uint16_t * _f_fontPackedIndex; ///< offsets of groups of 16 characters
+#endif // FONT_STORAGE
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    bool _f_fontProportional; ///< proportional text
+    const width_s * _f_fontWidths; ///< widths of characters for actual font
+    const kerning_s * _f_fontKerning; ///< kerning pairs, 0 = none
+    uint16_t _f_fontKerningNumber; ///< number of kerning pairs
+#endif // PROPORTIONAL_MODE
 
 };
 /// @endcond
@@ -0,0 +1,114 @@
+///
+/// @file hV_Font_Terminal_Rows.h
+/// @brief Terminal fonts as rows of pixels, transposed at compilation
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 16 Oct 2026
+/// @version 523
+///
+/// @copyright (c) Rei Vilo, 2010-2023
+/// @copyright All rights reserved
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @note Included by hV_Font_Terminal.cpp only, as the tables are evaluated by each translation unit
+///
+
+#ifndef hV_FONT_TERMINAL_ROWS_RELEASE
+///
+/// @brief Release
+///
+#define hV_FONT_TERMINAL_ROWS_RELEASE 523
+
+#include "hV_Font_Terminal.h"
+
+/// @cond
+///
+/// @brief Glyph as rows of pixels
+/// @details Rows of (width + 7) / 8 bytes, left column on bit 7
+///
+template <uint16_t N>
+struct _f_rows_s
+{
+    uint8_t data[N];
+};
+
+///
+/// @brief Table of 224 glyphs as rows of pixels
+///
+template <uint8_t W, uint8_t H>
+struct _f_table_s
+{
+    _f_rows_s < ((W + 7) >> 3) * H > glyph[224];
+};
+
+///
+/// @brief Get 8 pixels of row from glyph as columns
+/// @param columns glyph, columns of (height + 7) / 8 bytes, top row as bit 0
+/// @param width width of glyph
+/// @param bytes bytes per column
+/// @param row row
+/// @param column first column
+/// @param i index of pixel, 0..8
+/// @return pixels i..7, left pixel on bit 7
+///
+constexpr uint8_t _f_getRowBits(const uint8_t * columns, uint8_t width, uint8_t bytes, uint8_t row, uint8_t column, uint8_t i)
+{
+    return (i > 7) ? 0 :
+           (((column + i < width) ? ((columns[bytes * (column + i) + (row >> 3)] >> (row & 0x07)) & 0x01) << (7 - i) : 0)
+            | _f_getRowBits(columns, width, bytes, row, column, i + 1));
+}
+
+///
+/// @brief Transpose glyph from columns into rows
+/// @param columns glyph, columns of (H + 7) / 8 bytes
+/// @return glyph as rows of (W + 7) / 8 bytes
+///
+template <uint8_t W, uint8_t H, uint16_t... B>
+constexpr _f_rows_s<sizeof...(B)> _f_getRows(const uint8_t * columns, _f_sequence_s<B...>)
+{
+    return {{ _f_getRowBits(columns, W, (H + 7) >> 3, B / ((W + 7) >> 3), 8 * (B % ((W + 7) >> 3)), 0)... }};
+}
+
+///
+/// @brief Transpose table of 224 glyphs from columns into rows
+/// @param columns table of glyphs as columns
+/// @return table of glyphs as rows
+///
+template <uint8_t W, uint8_t H, uint16_t... C>
+constexpr _f_table_s<W, H> _f_getTable(const uint8_t (&columns)[224][W * ((H + 7) >> 3)], _f_sequence_s<C...>)
+{
+    return {{ _f_getRows<W, H>(columns[C], typename _f_makeSequence < ((W + 7) >> 3) * H >::type())... }};
+}
+/// @endcond
+
+///
+/// @name Terminal fonts as rows of pixels
+/// @details Same glyphs as Terminal*e.h, for BITMAP_ROW | BITMAP_MSB
+/// @{
+///
+#if (MAX_FONT_SIZE > 0)
+static constexpr _f_table_s<6, 8> Terminal6x8r = _f_getTable<6, 8>(Terminal6x8e, _f_makeSequence<224>::type()); ///< 6 x 8, 8 bytes per glyph
+#if (MAX_FONT_SIZE > 1)
+static constexpr _f_table_s<8, 12> Terminal8x12r = _f_getTable<8, 12>(Terminal8x12e, _f_makeSequence<224>::type()); ///< 8 x 12, 12 bytes per glyph
+#if (MAX_FONT_SIZE > 2)
+static constexpr _f_table_s<12, 16> Terminal12x16r = _f_getTable<12, 16>(Terminal12x16e, _f_makeSequence<224>::type()); ///< 12 x 16, 32 bytes per glyph
+#if (MAX_FONT_SIZE > 3)
+static constexpr _f_table_s<16, 24> Terminal16x24r = _f_getTable<16, 24>(Terminal16x24e, _f_makeSequence<224>::type()); ///< 16 x 24, 48 bytes per glyph
+#endif // end MAX_FONT_SIZE > 3
+#endif // end MAX_FONT_SIZE > 2
+#endif // end MAX_FONT_SIZE > 1
+#endif // end MAX_FONT_SIZE > 0
+/// @}
+
+#endif // hV_FONT_TERMINAL_ROWS_RELEASE
@@ -0,0 +1,130 @@
+///
+/// @file hV_Font_Terminal_Widths.h
+/// @brief Widths of Terminal fonts for proportional text, generated at compilation
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 16 Oct 2026
+/// @version 523
+///
+/// @copyright (c) Rei Vilo, 2010-2023
+/// @copyright All rights reserved
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @note Included by hV_Font_Terminal.cpp only, as the tables are evaluated by each translation unit
+///
+
+#ifndef hV_FONT_TERMINAL_WIDTHS_RELEASE
+///
+/// @brief Release
+///
+#define hV_FONT_TERMINAL_WIDTHS_RELEASE 523
+
+#include "hV_Font_Terminal.h"
+
+/// @cond
+///
+/// @brief Table of 224 widths
+///
+struct _f_widths_s
+{
+    width_s width[224];
+};
+
+///
+/// @brief Check column of glyph for set pixels
+/// @param columns glyph, columns of bytes, top row as bit 0
+/// @param bytes bytes per column
+/// @param column column
+/// @param b index of byte, 0..bytes
+/// @return true if any pixel of bytes b.. is set
+///
+constexpr bool _f_isColumnSet(const uint8_t * columns, uint8_t bytes, uint8_t column, uint8_t b)
+{
+    return (b < bytes) and ((columns[bytes * column + b] != 0) or _f_isColumnSet(columns, bytes, column, b + 1));
+}
+
+///
+/// @brief First column with set pixels
+/// @param columns glyph
+/// @param width width of glyph
+/// @param bytes bytes per column
+/// @param i first column to check
+/// @return first column with set pixels, width if none
+///
+constexpr uint8_t _f_getFirstColumn(const uint8_t * columns, uint8_t width, uint8_t bytes, uint8_t i)
+{
+    return (i >= width) ? width : (_f_isColumnSet(columns, bytes, i, 0) ? i : _f_getFirstColumn(columns, width, bytes, i + 1));
+}
+
+///
+/// @brief Column after last column with set pixels
+/// @param columns glyph
+/// @param bytes bytes per column
+/// @param i column after last column to check
+/// @return column after last column with set pixels, 0 if none
+///
+constexpr uint8_t _f_getEndColumn(const uint8_t * columns, uint8_t bytes, uint8_t i)
+{
+    return (i == 0) ? 0 : (_f_isColumnSet(columns, bytes, i - 1, 0) ? i : _f_getEndColumn(columns, bytes, i - 1));
+}
+
+///
+/// @brief Width of glyph
+/// @param columns glyph, columns of (H + 7) / 8 bytes
+/// @return columns with set pixels, W / 2 for blank glyph
+///
+template <uint8_t W, uint8_t H>
+constexpr width_s _f_getWidth(const uint8_t * columns)
+{
+    return (_f_getEndColumn(columns, (H + 7) >> 3, W) == 0) ?
+           width_s { W / 2, 0 } :
+           width_s
+    {
+        (uint16_t)(_f_getEndColumn(columns, (H + 7) >> 3, W) - _f_getFirstColumn(columns, W, (H + 7) >> 3, 0)),
+        _f_getFirstColumn(columns, W, (H + 7) >> 3, 0)
+    };
+}
+
+///
+/// @brief Widths of table of 224 glyphs
+/// @param columns table of glyphs as columns
+/// @return table of widths
+///
+template <uint8_t W, uint8_t H, uint16_t... C>
+constexpr _f_widths_s _f_getWidths(const uint8_t (&columns)[224][W * ((H + 7) >> 3)], _f_sequence_s<C...>)
+{
+    return {{ _f_getWidth<W, H>(columns[C])... }};
+}
+/// @endcond
+
+///
+/// @name Widths of Terminal fonts
+/// @details width_s.pixel for columns with set pixels, width_s.index for first column
+/// @{
+///
+#if (MAX_FONT_SIZE > 0)
+static constexpr _f_widths_s Terminal6x8w = _f_getWidths<6, 8>(Terminal6x8e, _f_makeSequence<224>::type()); ///< 6 x 8
+#if (MAX_FONT_SIZE > 1)
+static constexpr _f_widths_s Terminal8x12w = _f_getWidths<8, 12>(Terminal8x12e, _f_makeSequence<224>::type()); ///< 8 x 12
+#if (MAX_FONT_SIZE > 2)
+static constexpr _f_widths_s Terminal12x16w = _f_getWidths<12, 16>(Terminal12x16e, _f_makeSequence<224>::type()); ///< 12 x 16
+#if (MAX_FONT_SIZE > 3)
+static constexpr _f_widths_s Terminal16x24w = _f_getWidths<16, 24>(Terminal16x24e, _f_makeSequence<224>::type()); ///< 16 x 24
+#endif // end MAX_FONT_SIZE > 3
+#endif // end MAX_FONT_SIZE > 2
+#endif // end MAX_FONT_SIZE > 1
+#endif // end MAX_FONT_SIZE > 0
+/// @}
+
+#endif // hV_FONT_TERMINAL_WIDTHS_RELEASE
@@ -20,6 +20,8 @@
 
 // Library header
 #include "hV_Screen_Buffer.h"
+#include "stdarg.h"
+#include "stdio.h"
 //#include "QuickDebug.h"
 
 // Code
@@ -30,6 +32,26 @@ hV_Screen_Buffer::hV_Screen_Buffer()
     _f_fontSolid      = true;
     _penSolid       = false;
     _f_fontSpaceX     = 1;
+    _f_fontSpaceY     = 1;
+    _f_fontScale      = 1;
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    _f_fontProportional = false;
+    _f_fontKerning = 0;
+    _f_fontKerningNumber = 0;
+#endif // PROPORTIONAL_MODE
+
+    _originX = 0;
+    _originY = 0;
+    _clipX1 = 0;
+    _clipY1 = 0;
+    _clipX2 = 0x7fff;
+    _clipY2 = 0x7fff;
+
+#if (GLYPH_ATLAS_SIZE > 0)
+    memset(_atlasKey, 0xff, sizeof(_atlasKey));
+    memset(_atlasUse, 0x00, sizeof(_atlasUse));
+    _atlasTick = 0;
+#endif // GLYPH_ATLAS_SIZE
 }
 
 void hV_Screen_Buffer::begin()
@@ -39,13 +61,8 @@ void hV_Screen_Buffer::begin()
 
 void hV_Screen_Buffer::clear(uint16_t colour)
 {
-    uint8_t oldOrientation = _orientation;
-    bool oldPenSolid = _penSolid;
-    setOrientation(0);
-    setPenSolid();
-    rectangle(0, 0, screenSizeX() - 1, screenSizeY() - 1, colour);
-    setOrientation(oldOrientation);
-    setPenSolid(oldPenSolid);
+    // Whole screen, regardless of viewport
+    _setRectangle(0, 0, screenSizeX() - 1, screenSizeY() - 1, colour);
 }
 
 void hV_Screen_Buffer::flush()
@@ -85,6 +102,8 @@ void hV_Screen_Buffer::setOrientation(uint8_t orientation)
             _setOrientation(_orientation);
             break;
     }
+
+    resetViewport();
 }
 
 uint8_t hV_Screen_Buffer::getOrientation()
@@ -92,6 +111,54 @@ uint8_t hV_Screen_Buffer::getOrientation()
     return _orientation;
 }
 
+void hV_Screen_Buffer::setViewport(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    resetViewport();
+    if ((dx == 0) or (dy == 0))
+    {
+        // Empty clip window, nothing drawn
+        // Extreme values, so that any span misses it
+        _clipX1 = 0x7fff;
+        _clipY1 = 0x7fff;
+        _clipX2 = -0x8000;
+        _clipY2 = -0x8000;
+    }
+    else
+    {
+        setClip(x0, y0, x0 + dx - 1, y0 + dy - 1);
+    }
+    _originX = x0;
+    _originY = y0;
+}
+
+void hV_Screen_Buffer::resetViewport()
+{
+    _originX = 0;
+    _originY = 0;
+    _clipX1 = 0;
+    _clipY1 = 0;
+    _clipX2 = screenSizeX() - 1;
+    _clipY2 = screenSizeY() - 1;
+}
+
+void hV_Screen_Buffer::setClip(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    if (x1 > x2)
+    {
+        swap(x1, x2);
+    }
+    if (y1 > y2)
+    {
+        swap(y1, y2);
+    }
+
+    // Relative to origin, within screen
+    _clipX1 = max((int32_t)x1 + _originX, (int32_t)0);
+    _clipY1 = max((int32_t)y1 + _originY, (int32_t)0);
+    _clipX2 = min((int32_t)x2 + _originX, (int32_t)screenSizeX() - 1);
+    _clipY2 = min((int32_t)y2 + _originY, (int32_t)screenSizeY() - 1);
+}
+
 uint16_t hV_Screen_Buffer::screenSizeX()
 {
     switch (_orientation)
@@ -144,153 +211,269 @@ uint8_t hV_Screen_Buffer::screenColourBits()
 
 void hV_Screen_Buffer::circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour)
 {
-    int16_t f = 1 - radius;
-    int16_t ddF_x = 1;
-    int16_t ddF_y = -2 * radius;
-    int16_t x = 0;
-    int16_t y = radius;
+    // Trivial rejection
+    if (_getClipCode((int16_t)x0 - radius, (int16_t)y0 - radius) & _getClipCode((int16_t)x0 + radius, (int16_t)y0 + radius))
+    {
+        return;
+    }
 
     if (_penSolid == false)
     {
-        point(x0, y0 + radius, colour);
-        point(x0, y0 - radius, colour);
-        point(x0 + radius, y0, colour);
-        point(x0 - radius, y0, colour);
-
-        while (x < y)
+        _walkCircle(x0, y0, radius, [this, colour](uint16_t x, uint16_t y)
         {
-            if (f >= 0)
-            {
-                y--;
-                ddF_y += 2;
-                f += ddF_y;
-            }
-
-            x++;
-            ddF_x += 2;
-            f += ddF_x;
-
-            point(x0 + x, y0 + y, colour);
-            point(x0 - x, y0 + y, colour);
-            point(x0 + x, y0 - y, colour);
-            point(x0 - x, y0 - y, colour);
-            point(x0 + y, y0 + x, colour);
-            point(x0 - y, y0 + x, colour);
-            point(x0 + y, y0 - x, colour);
-            point(x0 - y, y0 - x, colour);
-        }
+            point(x, y, colour);
+        });
     }
     else
     {
-        while (x < y)
-        {
-            if (f >= 0)
-            {
-                y--;
-                ddF_y += 2;
-                f += ddF_y;
-            }
-
-            x++;
-            ddF_x += 2;
-            f += ddF_x;
-
-            line(x0 + x, y0 + y, x0 - x, y0 + y, colour); // bottom
-            line(x0 + x, y0 - y, x0 - x, y0 - y, colour); // top
-            line(x0 + y, y0 - x, x0 + y, y0 + x, colour); // right
-            line(x0 - y, y0 - x, x0 - y, y0 + x, colour); // left
-        }
-
-        setPenSolid(true);
-        rectangle(x0 - x, y0 - y, x0 + x, y0 + y, colour);
+        _setQuarters(x0, x0, y0, y0, radius, radius, colour);
     }
 }
 
-void hV_Screen_Buffer::dLine(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
+void hV_Screen_Buffer::ellipse(uint16_t x0, uint16_t y0, uint16_t radiusX, uint16_t radiusY, uint16_t colour)
 {
-    line(x0, y0, x0 + dx - 1, y0 + dy - 1, colour);
+    // Trivial rejection
+    if (_getClipCode((int16_t)x0 - radiusX, (int16_t)y0 - radiusY) & _getClipCode((int16_t)x0 + radiusX, (int16_t)y0 + radiusY))
+    {
+        return;
+    }
+
+    _setQuarters(x0, x0, y0, y0, radiusX, radiusY, colour);
 }
 
-void hV_Screen_Buffer::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+void hV_Screen_Buffer::roundedRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t radius, uint16_t colour)
 {
-    if ((x1 == x2) and (y1 == y2))
+    if (x1 > x2)
     {
-        _setPoint(x1, y1, colour);
+        swap(x1, x2);
     }
-    else if (x1 == x2)
+    if (y1 > y2)
     {
-        if (y1 > y2)
-        {
-            swap(y1, y2);
-        }
-        for (uint16_t y = y1; y <= y2; y++)
-        {
-            _setPoint(x1, y, colour);
-        }
+        swap(y1, y2);
     }
-    else if (y1 == y2)
+    radius = min(radius, (uint16_t)(min(x2 - x1, y2 - y1) / 2));
+
+    // Trivial rejection
+    if (_getClipCode(x1, y1) & _getClipCode(x2, y2))
     {
-        if (x1 > x2)
+        return;
+    }
+
+    // Corners with top and bottom sides
+    _setQuarters(x1 + radius, x2 - radius, y1 + radius, y2 - radius, radius, radius, colour);
+
+    // Middle band
+    if (y2 - y1 > 2 * radius)
+    {
+        if (_penSolid)
         {
-            swap(x1, x2);
+            _clipRectangle(x1, y1 + radius + 1, x2, y2 - radius - 1, colour);
         }
-        for (uint16_t x = x1; x <= x2; x++)
+        else
         {
-            _setPoint(x, y1, colour);
+            _clipSpanY(x1, y1 + radius + 1, y2 - radius - 1, colour);
+            _clipSpanY(x2, y1 + radius + 1, y2 - radius - 1, colour);
         }
     }
-    else
-    {
-        int16_t wx1 = (int16_t)x1;
-        int16_t wx2 = (int16_t)x2;
-        int16_t wy1 = (int16_t)y1;
-        int16_t wy2 = (int16_t)y2;
+}
 
-        bool flag = abs(wy2 - wy1) > abs(wx2 - wx1);
-        if (flag)
-        {
-            swap(wx1, wy1);
-            swap(wx2, wy2);
-        }
+void hV_Screen_Buffer::dRoundedRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t radius, uint16_t colour)
+{
+    roundedRectangle(x0, y0, x0 + dx - 1, y0 + dy - 1, radius, colour);
+}
 
-        if (wx1 > wx2)
-        {
-            swap(wx1, wx2);
-            swap(wy1, wy2);
-        }
+void hV_Screen_Buffer::_setQuarters(int16_t xLeft, int16_t xRight, int16_t yTop, int16_t yBottom, uint16_t radiusX, uint16_t radiusY, uint16_t colour)
+{
+    // Pixel (dx, dy) is inside if dx^2 * ry^2 + dy^2 * rx^2 - max(dx * ry^2, dy * rx^2) < rx^2 * ry^2
+    // Same pixels as the midpoint outline of circle() for rx = ry
+    // Error term updated incrementally, 32-bit up to radius 1000
+    int32_t rx2 = (int32_t)radiusX * radiusX;
+    int32_t ry2 = (int32_t)radiusY * radiusY;
+    int32_t error = 0; // dx^2 * ry^2 + dy^2 * rx^2 - rx^2 * ry^2 for (widthNext, dy + 1)
 
-        int16_t dx = wx2 - wx1;
-        int16_t dy = abs(wy2 - wy1);
-        int16_t err = dx / 2;
-        int16_t ystep;
+    int16_t width = radiusX; // half-width for dy
+    int16_t widthNext = radiusX; // half-width for dy + 1
 
-        if (wy1 < wy2)
+    for (uint16_t dy = 0; dy <= radiusY; dy++)
+    {
+        // Half-width of next scanline, -1 after the last one
+        if (dy < radiusY)
         {
-            ystep = 1;
+            error += rx2 * (2 * dy + 1);
+            while ((widthNext > 0) and (error >= max((int32_t)widthNext * ry2, (int32_t)(dy + 1) * rx2)))
+            {
+                error -= ry2 * (2 * widthNext - 1);
+                widthNext--;
+            }
         }
         else
         {
-            ystep = -1;
+            widthNext = -1;
         }
 
-        for (; wx1 <= wx2; wx1++)
+        for (uint8_t side = 0; side < 2; side++)
         {
-            if (flag)
+            int16_t y = (side == 0) ? yTop - dy : yBottom + dy;
+            if ((side == 1) and (y == yTop - (int16_t)dy))
             {
-                _setPoint(wy1, wx1, colour);
+                break; // same scanline
             }
-            else
+
+            int16_t inner = min((int16_t)(widthNext + 1), width);
+            if ((_penSolid) or (dy == radiusY) or (xLeft - inner + 1 >= xRight + inner))
             {
-                _setPoint(wx1, wy1, colour);
+                _clipSpanX(xLeft - width, xRight + width, y, colour);
             }
-
-            err -= dy;
-            if (err < 0)
+            else
             {
-                wy1 += ystep;
-                err += dx;
+                _clipSpanX(xLeft - width, xLeft - inner, y, colour);
+                _clipSpanX(xRight + inner, xRight + width, y, colour);
             }
         }
+
+        width = widthNext;
+    }
+}
+
+uint8_t hV_Screen_Buffer::_getClipCode(int16_t x1, int16_t y1)
+{
+    // Relative to origin
+    int32_t x = (int32_t)x1 + _originX;
+    int32_t y = (int32_t)y1 + _originY;
+    uint8_t code = 0;
+
+    if (x < _clipX1)
+    {
+        code |= 0x01; // left
+    }
+    else if (x > _clipX2)
+    {
+        code |= 0x02; // right
+    }
+    if (y < _clipY1)
+    {
+        code |= 0x04; // top
+    }
+    else if (y > _clipY2)
+    {
+        code |= 0x08; // bottom
+    }
+
+    return code;
+}
+
+bool hV_Screen_Buffer::_clipCoordinates(uint16_t & x1, uint16_t & y1)
+{
+    int32_t x = (int32_t)(int16_t)x1 + _originX;
+    int32_t y = (int32_t)(int16_t)y1 + _originY;
+
+    if ((x < _clipX1) or (x > _clipX2) or (y < _clipY1) or (y > _clipY2))
+    {
+        return true;
+    }
+
+    x1 = x;
+    y1 = y;
+    return false;
+}
+
+void hV_Screen_Buffer::_clipSpanX(int16_t x1, int16_t x2, int16_t y1, uint16_t colour)
+{
+    // Relative to origin, x1 <= x2
+    int32_t x = (int32_t)x1 + _originX;
+    int32_t xx = (int32_t)x2 + _originX;
+    int32_t y = (int32_t)y1 + _originY;
+
+    if ((y < _clipY1) or (y > _clipY2) or (xx < _clipX1) or (x > _clipX2))
+    {
+        return;
+    }
+    _setSpanX(max(x, (int32_t)_clipX1), min(xx, (int32_t)_clipX2), y, colour);
+}
+
+void hV_Screen_Buffer::_clipSpanY(int16_t x1, int16_t y1, int16_t y2, uint16_t colour)
+{
+    // Relative to origin, y1 <= y2
+    int32_t x = (int32_t)x1 + _originX;
+    int32_t y = (int32_t)y1 + _originY;
+    int32_t yy = (int32_t)y2 + _originY;
+
+    if ((x < _clipX1) or (x > _clipX2) or (yy < _clipY1) or (y > _clipY2))
+    {
+        return;
+    }
+    _setSpanY(x, max(y, (int32_t)_clipY1), min(yy, (int32_t)_clipY2), colour);
+}
+
+void hV_Screen_Buffer::_clipRectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t colour)
+{
+    // Relative to origin, x1 <= x2 and y1 <= y2
+    int32_t x = (int32_t)x1 + _originX;
+    int32_t y = (int32_t)y1 + _originY;
+    int32_t xx = (int32_t)x2 + _originX;
+    int32_t yy = (int32_t)y2 + _originY;
+
+    if ((xx < _clipX1) or (x > _clipX2) or (yy < _clipY1) or (y > _clipY2))
+    {
+        return;
+    }
+    _setRectangle(max(x, (int32_t)_clipX1), max(y, (int32_t)_clipY1), min(xx, (int32_t)_clipX2), min(yy, (int32_t)_clipY2), colour);
+}
+
+void hV_Screen_Buffer::dLine(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
+{
+    line(x0, y0, x0 + dx - 1, y0 + dy - 1, colour);
+}
+
+void hV_Screen_Buffer::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    int16_t wx1 = (int16_t)x1;
+    int16_t wx2 = (int16_t)x2;
+    int16_t wy1 = (int16_t)y1;
+    int16_t wy2 = (int16_t)y2;
+
+    if ((wx1 == wx2) and (wy1 == wy2))
+    {
+        point(x1, y1, colour);
+    }
+    else if (wx1 == wx2)
+    {
+        if (wy1 > wy2)
+        {
+            swap(wy1, wy2);
+        }
+        _clipSpanY(wx1, wy1, wy2, colour);
+    }
+    else if (wy1 == wy2)
+    {
+        if (wx1 > wx2)
+        {
+            swap(wx1, wx2);
+        }
+        _clipSpanX(wx1, wx2, wy1, colour);
+    }
+    else
+    {
+        _walkLine(wx1, wy1, wx2, wy2, [this, colour](int32_t x, int32_t y)
+        {
+            _setPoint(x, y, colour);
+        });
+    }
+}
+
+void hV_Screen_Buffer::_setSpanX(uint16_t x1, uint16_t x2, uint16_t y1, uint16_t colour)
+{
+    for (uint16_t x = x1; x <= x2; x++)
+    {
+        _setPoint(x, y1, colour);
+    }
+}
+
+void hV_Screen_Buffer::_setSpanY(uint16_t x1, uint16_t y1, uint16_t y2, uint16_t colour)
+{
+    for (uint16_t y = y1; y <= y2; y++)
+    {
+        _setPoint(x1, y, colour);
     }
 }
 
@@ -301,6 +484,10 @@ void hV_Screen_Buffer::setPenSolid(bool flag)
 
 void hV_Screen_Buffer::point(uint16_t x1, uint16_t y1, uint16_t colour)
 {
+    if (_clipCoordinates(x1, y1))
+    {
+        return;
+    }
     _setPoint(x1, y1, colour);
 }
 
@@ -315,194 +502,393 @@ void hV_Screen_Buffer::rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t
     }
     else
     {
-        if (x1 > x2)
-        {
-            swap(x1, x2);
-        }
-        if (y1 > y2)
+        int16_t wx1 = (int16_t)x1;
+        int16_t wx2 = (int16_t)x2;
+        int16_t wy1 = (int16_t)y1;
+        int16_t wy2 = (int16_t)y2;
+
+        if (wx1 > wx2)
         {
-            swap(y1, y2);
+            swap(wx1, wx2);
         }
-        for (uint16_t x = x1; x <= x2; x++)
+        if (wy1 > wy2)
         {
-            for (uint16_t y = y1; y <= y2; y++)
-            {
-                _setPoint(x, y, colour);
-            }
+            swap(wy1, wy2);
         }
+        _clipRectangle(wx1, wy1, wx2, wy2, colour);
     }
 }
 
-void hV_Screen_Buffer::dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
+void hV_Screen_Buffer::_setRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
 {
-    rectangle(x0, y0, x0 + dx - 1, y0 + dy - 1, colour);
+    for (uint16_t x = x1; x <= x2; x++)
+    {
+        _setSpanY(x, y1, y2, colour);
+    }
 }
 
-void hV_Screen_Buffer::_triangleArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
+void hV_Screen_Buffer::bitmap(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint8_t * data,
+                              uint8_t format, uint8_t mode,
+                              uint16_t frontColour, uint16_t backColour,
+                              const uint8_t * mask)
 {
-    int16_t wx1 = (int16_t)x1;
-    int16_t wy1 = (int16_t)y1;
-    int16_t wx2 = (int16_t)x2;
-    int16_t wy2 = (int16_t)y2;
-    int16_t wx3 = (int16_t)x3;
-    int16_t wy3 = (int16_t)y3;
-    int16_t wx4 = wx1;
-    int16_t wy4 = wy1;
-    int16_t wx5 = wx1;
-    int16_t wy5 = wy1;
+    bitmap_s bitmap = {data, 0, mask, dx, dy, format, mode, frontColour, backColour};
+    _clipBitmap(x0, y0, bitmap);
+}
 
-    bool changed1 = false;
-    bool changed2 = false;
+void hV_Screen_Buffer::bitmapBlackRed(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint8_t * dataBlack, const uint8_t * dataRed,
+                                      uint8_t format, uint8_t mode,
+                                      const uint8_t * mask)
+{
+    bitmap_s bitmap = {dataBlack, dataRed, mask, dx, dy, format, mode, myColours.black, myColours.white};
+    _clipBitmap(x0, y0, bitmap);
+}
 
-    int16_t dx1 = abs(wx2 - wx1);
-    int16_t dy1 = abs(wy2 - wy1);
+void hV_Screen_Buffer::_clipBitmap(int16_t x0, int16_t y0, const bitmap_s & bitmap)
+{
+    if ((bitmap.sizeX == 0) or (bitmap.sizeY == 0) or ((bitmap.mode == BITMAP_MASKED) and (bitmap.mask == 0)))
+    {
+        return;
+    }
 
-    int16_t dx2 = abs(wx3 - wx1);
-    int16_t dy2 = abs(wy3 - wy1);
+    // Absolute coordinates, trimmed to the clip window
+    int32_t x = (int32_t)x0 + _originX;
+    int32_t y = (int32_t)y0 + _originY;
+    int32_t xx = x + bitmap.sizeX - 1;
+    int32_t yy = y + bitmap.sizeY - 1;
 
-    int16_t signx1 = (wx2 >= wx1) ? +1 : -1;
-    int16_t signx2 = (wx3 >= wx1) ? +1 : -1;
+    if ((xx < _clipX1) or (x > _clipX2) or (yy < _clipY1) or (y > _clipY2))
+    {
+        return;
+    }
+    _setBitmap(x, y, max(x, (int32_t)_clipX1), max(y, (int32_t)_clipY1), min(xx, (int32_t)_clipX2), min(yy, (int32_t)_clipY2), bitmap);
+}
+
+uint8_t hV_Screen_Buffer::_getNativeFormat()
+{
+    return BITMAP_COLUMN;
+}
 
-    int16_t signy1 = (wy2 >= wy1) ? +1 : -1;
-    int16_t signy2 = (wy3 >= wy1) ? +1 : -1;
+bool hV_Screen_Buffer::_getBitmapPixel(const uint8_t * plane, const bitmap_s & bitmap, uint16_t x1, uint16_t y1)
+{
+    // Line along the major axis, index within the line
+    if (bitmap.format & BITMAP_COLUMN)
+    {
+        swap(x1, y1);
+    }
+    uint16_t stride = ((bitmap.format & BITMAP_COLUMN) ? bitmap.sizeY + 7 : bitmap.sizeX + 7) >> 3;
+    uint8_t value = plane[(uint32_t)y1 * stride + (x1 >> 3)];
+    uint8_t bit = (bitmap.format & BITMAP_LSB) ? (x1 & 0x07) : 7 - (x1 & 0x07);
+    return bitRead(value, bit);
+}
 
-    if (dy1 > dx1)
+uint8_t hV_Screen_Buffer::_getBitmapBits(const uint8_t * plane, const bitmap_s & bitmap, int16_t x1, int16_t y1, int8_t step, uint8_t count)
+{
+    // Line along the major axis, index within the line
+    uint16_t line = y1;
+    int16_t index = x1;
+    uint16_t stride = (bitmap.sizeX + 7) >> 3;
+    if (bitmap.format & BITMAP_COLUMN)
+    {
+        line = x1;
+        index = y1;
+        stride = (bitmap.sizeY + 7) >> 3;
+    }
+    if (step < 0)
     {
-        swap(dx1, dy1); // swap values
-        changed1 = true;
+        index -= count - 1;
     }
 
-    if (dy2 > dx2)
+    // Up to two bytes
+    const uint8_t * pointer = plane + (uint32_t)line * stride + (index >> 3);
+    uint8_t shift = index & 0x07;
+    uint8_t byte1 = pointer[0];
+    uint8_t byte2 = (shift + count > 8) ? pointer[1] : 0;
+    if (bitmap.format & BITMAP_LSB)
     {
-        swap(dx2, dy2); // swap values
-        changed2 = true;
+        byte1 = reverseBits(byte1);
+        byte2 = reverseBits(byte2);
     }
 
-    int16_t e1 = 2 * dy1 - dx1;
-    int16_t e2 = 2 * dy2 - dx2;
+    uint8_t value = (uint8_t)((((uint16_t)byte1 << 8) | byte2) >> (8 - shift));
+    value &= (uint8_t)(0xff << (8 - count));
 
-    for (int i = 0; i <= dx1; i++)
+    if (step < 0)
     {
-        line(wx4, wy4, wx5, wy5, colour);
+        value = (uint8_t)(reverseBits(value) << (8 - count));
+    }
+    return value;
+}
 
-        while (e1 >= 0)
-        {
-            if (changed1)
-            {
-                wx4 += signx1;
-            }
-            else
-            {
-                wy4 += signy1;
-            }
-            e1 = e1 - 2 * dx1;
-        }
+void hV_Screen_Buffer::_getBitmapBlock(const uint8_t * plane, const bitmap_s & bitmap, int16_t x1, int16_t y1,
+                                       int8_t rowX, int8_t rowY, int8_t bitX, int8_t bitY,
+                                       uint8_t rows, uint8_t bits, uint8_t * block)
+{
+    memset(block, 0x00, 8);
 
-        if (changed1)
+    bool flagColumn = (bitmap.format & BITMAP_COLUMN);
+    if ((flagColumn and (bitY != 0)) or ((flagColumn == false) and (bitX != 0)))
+    {
+        // Bits along the major axis
+        for (uint8_t i = 0; i < rows; i++)
         {
-            wy4 += signy1;
+            block[i] = _getBitmapBits(plane, bitmap, x1 + i * rowX, y1 + i * rowY, bitX + bitY, bits);
         }
-        else
+    }
+    else
+    {
+        // Rows along the major axis, then transposed
+        for (uint8_t i = 0; i < bits; i++)
         {
-            wx4 += signx1;
+            block[i] = _getBitmapBits(plane, bitmap, x1 + i * bitX, y1 + i * bitY, rowX + rowY, rows);
         }
+        transpose8x8(block);
+    }
+}
 
-        e1 = e1 + 2 * dy1;
-
-        while (wy5 != wy4)
+void hV_Screen_Buffer::_setBitmap(int16_t x0, int16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, const bitmap_s & bitmap)
+{
+    for (uint16_t y = y1; y <= y2; y++)
+    {
+        for (uint16_t x = x1; x <= x2; x++)
         {
-            while (e2 >= 0)
+            uint16_t xx = x - x0;
+            uint16_t yy = y - y0;
+            bool flagData = _getBitmapPixel(bitmap.data, bitmap, xx, yy);
+            bool flagRed = (bitmap.red != 0) ? _getBitmapPixel(bitmap.red, bitmap, xx, yy) : false;
+
+            // Pixels to draw
+            if (bitmap.mode == BITMAP_MASKED)
             {
-                if (changed2)
+                if (_getBitmapPixel(bitmap.mask, bitmap, xx, yy) == false)
                 {
-                    wx5 += signx2;
+                    continue;
                 }
-                else
-                {
-                    wy5 += signy2;
-                }
-                e2 = e2 - 2 * dx2;
+            }
+            else if ((bitmap.mode == BITMAP_TRANSPARENT) and (flagData == false) and (flagRed == false))
+            {
+                continue;
             }
 
-            if (changed2)
+            if (flagData)
             {
-                wy5 += signy2;
+                _setPoint(x, y, bitmap.frontColour);
+            }
+            else if (flagRed)
+            {
+                _setPoint(x, y, myColours.red);
             }
             else
             {
-                wx5 += signx2;
+                _setPoint(x, y, bitmap.backColour);
             }
-
-            e2 = e2 + 2 * dy2;
         }
     }
 }
 
-void hV_Screen_Buffer::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
+void hV_Screen_Buffer::dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour)
 {
-    if ((x1 == x2) and (y1 == y2))
+    rectangle(x0, y0, x0 + dx - 1, y0 + dy - 1, colour);
+}
+
+// Rounded division, denominator > 0
+static int16_t roundDivide(int32_t numerator, int32_t denominator)
+{
+    numerator = 2 * numerator + denominator;
+    denominator *= 2;
+    return (numerator >= 0) ? numerator / denominator : -((denominator - 1 - numerator) / denominator);
+}
+
+void hV_Screen_Buffer::_fillPolygon(const uint16_t * pointsX, const uint16_t * pointsY, uint8_t number, uint16_t colour)
+{
+    // Crossings, sorted by x, with run of the edge on the line
+    int16_t crossingX[MAX_POLYGON_CROSSINGS];
+    int16_t crossingLow[MAX_POLYGON_CROSSINGS];
+    int16_t crossingHigh[MAX_POLYGON_CROSSINGS];
+    // Spans, sorted by first x
+    int16_t spanX1[MAX_POLYGON_CROSSINGS];
+    int16_t spanX2[MAX_POLYGON_CROSSINGS];
+
+    if (number == 0)
     {
-        line(x3, y3, x1, y1, colour);
+        return;
     }
-    else if ((x1 == x3) and (y1 == y3))
+
+    // Coordinates limited to +/-8192 to keep products within int32_t
+    auto pointX = [pointsX](uint8_t i) -> int16_t { return constrain((int16_t)pointsX[i], -8192, 8191); };
+    auto pointY = [pointsY](uint8_t i) -> int16_t { return constrain((int16_t)pointsY[i], -8192, 8191); };
+
+    int16_t xMin = pointX(0);
+    int16_t xMax = xMin;
+    int16_t yMin = pointY(0);
+    int16_t yMax = yMin;
+    for (uint8_t i = 1; i < number; i++)
     {
-        line(x2, y2, x3, y3, colour);
+        xMin = min(xMin, pointX(i));
+        xMax = max(xMax, pointX(i));
+        yMin = min(yMin, pointY(i));
+        yMax = max(yMax, pointY(i));
     }
-    else if ((x2 == x3) and (y2 == y3))
+
+    // Trivial rejection
+    if (_getClipCode(xMin, yMin) & _getClipCode(xMax, yMax))
     {
-        line(x1, y1, x2, y2, colour);
+        return;
     }
-    else if (_penSolid)
+    int16_t yTop = max(yMin, (int16_t)(_clipY1 - _originY));
+    int16_t yBottom = min(yMax, (int16_t)(_clipY2 - _originY));
+
+    // Too many edges on a line, outline instead
+    if (number > MAX_POLYGON_CROSSINGS)
+    {
+        for (int16_t y = yTop; y <= yBottom; y++)
+        {
+            uint8_t edges = 0;
+            for (uint8_t i = 0; i < number; i++)
+            {
+                uint8_t j = (i + 1) % number;
+                if ((y >= min(pointY(i), pointY(j))) and (y <= max(pointY(i), pointY(j))))
+                {
+                    edges++;
+                }
+            }
+
+            if (edges > MAX_POLYGON_CROSSINGS)
+            {
+                for (uint8_t i = 0; i < number; i++)
+                {
+                    uint8_t j = (i + 1) % number;
+                    line(pointsX[i], pointsY[i], pointsX[j], pointsY[j], colour);
+                }
+                return;
+            }
+        }
+    }
+
+    for (int16_t y = yTop; y <= yBottom; y++)
     {
-        bool b = true;
+        uint8_t crossings = 0;
+        uint8_t spans = 0;
 
-        // Graham Scan + Andrew's Monotone Chain Algorithm
-        // Sort by ascending y
-        while (b)
+        for (uint8_t i = 0; i < number; i++)
         {
-            b = false;
-            if ((b == false) and (y1 > y2))
+            uint8_t j = (i + 1) % number;
+            int16_t x1 = pointX(i);
+            int16_t y1 = pointY(i);
+            int16_t x2 = pointX(j);
+            int16_t y2 = pointY(j);
+
+            if (y1 > y2)
             {
                 swap(x1, x2);
                 swap(y1, y2);
-                b = true;
             }
-            if ((b == false) and (y2 > y3))
+            if ((y < y1) or (y > y2))
             {
-                swap(x3, x2);
-                swap(y3, y2);
-                b = true;
+                continue;
+            }
+
+            // Run of the edge between y - 0.5 and y + 0.5, as drawn by line()
+            int16_t low = min(x1, x2);
+            int16_t high = max(x1, x2);
+            int16_t x = x1;
+            if (y1 < y2)
+            {
+                int32_t dx = x2 - x1;
+                int32_t dy2 = 2 * (y2 - y1);
+                int16_t xTop = x1 + roundDivide(dx * max(2 * (y - y1) - 1, 0), dy2);
+                int16_t xBottom = x1 + roundDivide(dx * min(2 * (y - y1) + 1, (int32_t)dy2), dy2);
+                x = x1 + roundDivide(dx * 2 * (y - y1), dy2);
+                low = min(xTop, xBottom);
+                high = max(xTop, xBottom);
+            }
+
+            // Crossing for the even-odd rule, half-open [y1, y2) except for the last line
+            if ((y1 < y2) and ((y < y2) or (y == yMax)))
+            {
+                // Insertion sort
+                uint8_t k = crossings;
+                while ((k > 0) and (crossingX[k - 1] > x))
+                {
+                    crossingX[k] = crossingX[k - 1];
+                    crossingLow[k] = crossingLow[k - 1];
+                    crossingHigh[k] = crossingHigh[k - 1];
+                    k--;
+                }
+                crossingX[k] = x;
+                crossingLow[k] = low;
+                crossingHigh[k] = high;
+                crossings++;
+            }
+            // Horizontal edge, or end of edge
+            else
+            {
+                spanX1[spans] = low;
+                spanX2[spans] = high;
+                spans++;
             }
         }
 
-        if (y2 == y3)
+        // Even-odd rule, one span per pair of crossings, extended to the runs of both edges
+        for (uint8_t k = 0; k + 1 < crossings; k += 2)
         {
-            _triangleArea(x1, y1, x2, y2, x3, y3, colour);
+            spanX1[spans] = min(crossingLow[k], crossingLow[k + 1]);
+            spanX2[spans] = max(crossingHigh[k], crossingHigh[k + 1]);
+            spans++;
         }
-        else if (y1 == y2)
+
+        // Insertion sort, then overlapping spans merged, each pixel set once
+        for (uint8_t k = 1; k < spans; k++)
         {
-            _triangleArea(x3, y3, x1, y1, x2, y2, colour);
+            int16_t first = spanX1[k];
+            int16_t last = spanX2[k];
+            uint8_t l = k;
+            while ((l > 0) and (spanX1[l - 1] > first))
+            {
+                spanX1[l] = spanX1[l - 1];
+                spanX2[l] = spanX2[l - 1];
+                l--;
+            }
+            spanX1[l] = first;
+            spanX2[l] = last;
         }
-        else
-        {
-            uint16_t x4 = (uint16_t)((int32_t)x1 + (y2 - y1) * (x3 - x1) / (y3 - y1));
-            uint16_t y4 = y2;
 
-            _triangleArea(x1, y1, x2, y2, x4, y4, colour);
-#if defined(ESP8266)
-            delay(1);
-#else
-            delayMicroseconds(1000); // delay(1);
-#endif // ESP8266
-            delayMicroseconds(1000); // delay(1);
-            _triangleArea(x3, y3, x2, y2, x4, y4, colour);
-#if defined(ESP8266)
-            delay(1);
-#else
-            delayMicroseconds(1000); // delay(1);
-#endif // ESP8266
+        uint8_t k = 0;
+        while (k < spans)
+        {
+            int16_t first = spanX1[k];
+            int16_t last = spanX2[k];
+            k++;
+            while ((k < spans) and (spanX1[k] <= last + 1))
+            {
+                last = max(last, spanX2[k]);
+                k++;
+            }
+            _clipSpanX(first, last, y, colour);
         }
     }
+}
+
+void hV_Screen_Buffer::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
+{
+    if ((x1 == x2) and (y1 == y2))
+    {
+        line(x3, y3, x1, y1, colour);
+    }
+    else if ((x1 == x3) and (y1 == y3))
+    {
+        line(x2, y2, x3, y3, colour);
+    }
+    else if ((x2 == x3) and (y2 == y3))
+    {
+        line(x1, y1, x2, y2, colour);
+    }
+    else if (_penSolid)
+    {
+        uint16_t pointsX[3] = {x1, x2, x3};
+        uint16_t pointsY[3] = {y1, y2, y3};
+        _fillPolygon(pointsX, pointsY, 3, colour);
+    }
     else
     {
         line(x1, y1, x2, y2, colour);
@@ -511,6 +897,30 @@ void hV_Screen_Buffer::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t
     }
 }
 
+void hV_Screen_Buffer::polygon(const uint16_t * pointsX, const uint16_t * pointsY, uint8_t number, uint16_t colour)
+{
+    if (number == 0)
+    {
+        return;
+    }
+    else if (number == 1)
+    {
+        point(pointsX[0], pointsY[0], colour);
+    }
+    else if (_penSolid)
+    {
+        _fillPolygon(pointsX, pointsY, number, colour);
+    }
+    else
+    {
+        for (uint8_t i = 0; i < number; i++)
+        {
+            uint8_t j = (i + 1) % number;
+            line(pointsX[i], pointsY[i], pointsX[j], pointsY[j], colour);
+        }
+    }
+}
+
 // Font functions
 void hV_Screen_Buffer::setFontSolid(bool flag)
 {
@@ -542,7 +952,7 @@ uint16_t hV_Screen_Buffer::characterSizeX(uint8_t character)
     uint16_t result = 0;
     if ((_f_font.kind & 0x40) == 0x40) // Monospaced font
     {
-        result = _f_font.maxWidth + _f_fontSpaceX;
+        result = (_f_font.maxWidth + _f_fontSpaceX) * _f_fontScale;
     }
     else
     {
@@ -559,12 +969,22 @@ uint16_t hV_Screen_Buffer::characterSizeY()
 
 uint16_t hV_Screen_Buffer::stringSizeX(String text)
 {
-    return _f_stringSizeX(text);
+    return _f_stringSizeX(text.c_str(), text.length());
+}
+
+uint16_t hV_Screen_Buffer::stringSizeX(const char * text)
+{
+    return _f_stringSizeX(text, strlen(text));
 }
 
-uint8_t hV_Screen_Buffer::stringLengthToFitX(String text, uint16_t pixels)
+uint16_t hV_Screen_Buffer::stringLengthToFitX(String text, uint16_t pixels)
 {
-    return _f_stringLengthToFitX(text, pixels);
+    return _f_stringLengthToFitX(text.c_str(), text.length(), pixels);
+}
+
+uint16_t hV_Screen_Buffer::stringLengthToFitX(const char * text, uint16_t pixels)
+{
+    return _f_stringLengthToFitX(text, strlen(text), pixels);
 }
 
 void hV_Screen_Buffer::setFontSpaceX(uint8_t number)
@@ -577,157 +997,515 @@ void hV_Screen_Buffer::setFontSpaceY(uint8_t number)
     _f_setFontSpaceY(number);
 }
 
+void hV_Screen_Buffer::setFontScale(uint8_t scale)
+{
+    _f_setFontScale(scale);
+}
+
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+void hV_Screen_Buffer::setFontProportional(bool flag)
+{
+    _f_setFontProportional(flag);
+}
+
+void hV_Screen_Buffer::setFontKerning(const kerning_s * table, uint16_t number)
+{
+    _f_setFontKerning(table, number);
+}
+#endif // PROPORTIONAL_MODE
+
 uint8_t hV_Screen_Buffer::_getCharacter(uint8_t character, uint8_t index)
 {
     return _f_getCharacter(character, index);
 }
 
-void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
-                             String text,
-                             uint16_t textColour,
-                             uint16_t backColour)
-#if (FONT_MODE == USE_FONT_TERMINAL)
+void hV_Screen_Buffer::_setColumnText(int16_t x0, int16_t y0, const char * text, uint16_t length, uint16_t textColour, uint16_t backColour)
 {
-    uint8_t c;
-    uint8_t line, line1, line2, line3;
-    uint16_t x, y;
-    uint8_t i, j, k;
-#if (MAX_FONT_SIZE > 0)
-    if (_f_fontSize == 0)
+    // Block of up to 8 columns of up to 3 bytes, scaled up to 12 bytes, top row as LSB
+    uint8_t scale = _f_fontScale;
+    uint8_t bytes = (_f_font.height + 7) >> 3;
+    uint16_t sizeY = _f_font.height * scale;
+    uint8_t stride = (sizeY + 7) >> 3;
+    uint8_t block[8 * 12];
+    uint8_t scaled[12];
+    uint8_t number = 0;
+    bitmap_s glyph = {block, 0, 0, 8, sizeY,
+                      BITMAP_COLUMN | BITMAP_LSB, (uint8_t)(_f_fontSolid ? BITMAP_OPAQUE : BITMAP_TRANSPARENT),
+                      textColour, backColour
+                     };
+
+#if (FONT_STORAGE == USE_FONT_PACKED)
+    stream_s stream;
+#else
+    const uint8_t * table = _f_getCharacterTable();
+    uint16_t size = _f_font.maxWidth * bytes;
+    if (table == 0)
+    {
+        return;
+    }
+#endif // FONT_STORAGE
+
+    int16_t x = x0;
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    uint8_t previous = 0;
+#endif // PROPORTIONAL_MODE
+
+    uint16_t index = 0;
+
+    while (index < length)
     {
-        for (k = 0; k < text.length(); k++)
+        uint8_t character = _f_getCode(decodeUTF8(text, length, index));
+        uint8_t c = character - _f_font.first;
+
+        // All columns for monospaced text
+        uint8_t column = 0;
+        uint8_t end = _f_font.maxWidth;
+
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+        if (_f_fontProportional)
         {
-            c = text.charAt(k) - ' ';
+            // Columns with set pixels
+            column = _f_fontWidths[c].index;
+            end = column + _f_fontWidths[c].pixel;
 
-            for (i = 0; i < 6; i++)
+            if ((previous > 0) and (_f_fontKerningNumber > 0))
             {
-                line = _f_getCharacter(c, i);
-
-                for (j = 0; j < 8; j++)
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 6 * k + i, y0 + j, textColour);
-                    }
-                    else if (_f_fontSolid)
-                    {
-                        point(x0 + 6 * k + i, y0 + j, backColour);
-                    }
+                x += _f_getKerning(previous, character) * scale;
             }
+            previous = character;
         }
-    }
-#if (MAX_FONT_SIZE > 1)
-    else if (_f_fontSize == 1)
-    {
-        for (k = 0; k < text.length(); k++)
+#endif // PROPORTIONAL_MODE
+
+#if (FONT_STORAGE == USE_FONT_PACKED)
+        _f_openPacked(c, stream);
+#endif // FONT_STORAGE
+
+        for (; column < end; column++)
         {
-            c = text.charAt(k) - ' ';
+            uint32_t value = 0;
+#if (FONT_STORAGE == USE_FONT_PACKED)
+            if ((column >= stream.first) and (column < stream.first + stream.columns))
+            {
+                value = _f_readPacked(stream);
+            }
+#else
+            for (uint8_t b = 0; b < bytes; b++)
+            {
+                value |= (uint32_t)table[c * size + bytes * column + b] << (8 * b);
+            }
+#endif // FONT_STORAGE
 
-            for (i = 0; i < 8; i++)
+            // Column expanded along y, then repeated along x
+            for (uint8_t b = 0; b < bytes; b++)
             {
-                line = _f_getCharacter(c, 2 * i);
-                line1 = _f_getCharacter(c, 2 * i + 1);
+                uint32_t expanded = expandBits((uint8_t)(value >> (8 * b)), scale);
+                for (uint8_t j = 0; j < scale; j++)
+                {
+                    scaled[b * scale + j] = (uint8_t)(expanded >> (8 * j));
+                }
+            }
 
-                for (j = 0; j < 8; j++)
+            for (uint8_t i = 0; i < scale; i++)
+            {
+                memcpy(block + stride * number, scaled, stride);
+                number++;
+                if (number == 8)
                 {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 8 * k + i, y0 + j, textColour);
-                    }
-                    else if (_f_fontSolid)
-                    {
-                        point(x0 + 8 * k + i, y0 + j, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 8 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if ((_f_fontSolid) and (j < 4))
-                    {
-                        point(x0 + 8 * k + i, y0 + 8 + j, backColour);
-                    }
+                    glyph.sizeX = number;
+                    _clipBitmap(x, y0, glyph);
+                    x += number;
+                    number = 0;
                 }
             }
         }
+
+        // Remaining columns of character
+        if (number > 0)
+        {
+            glyph.sizeX = number;
+            _clipBitmap(x, y0, glyph);
+            x += number;
+            number = 0;
+        }
+
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+        if (_f_fontProportional)
+        {
+            if ((_f_fontSolid) and (_f_fontSpaceX > 0))
+            {
+                _clipRectangle(x, y0, x + _f_fontSpaceX * scale - 1, y0 + sizeY - 1, backColour);
+            }
+            x += _f_fontSpaceX * scale;
+        }
+#endif // PROPORTIONAL_MODE
     }
-#if (MAX_FONT_SIZE > 2)
-    else if (_f_fontSize == 2)
+}
+
+#if (GLYPH_ATLAS_SIZE > 0)
+const uint8_t * hV_Screen_Buffer::_getAtlasGlyph(const uint8_t * table, uint8_t character)
+{
+    uint16_t key = ((uint16_t)_f_fontSize << 8) | character;
+    uint8_t slot = 0;
+
+    // Tick wraps around, all glyphs equally old
+    _atlasTick++;
+    if (_atlasTick == 0)
     {
+        for (uint8_t i = 0; i < GLYPH_ATLAS_SIZE; i++)
+        {
+            _atlasUse[i] = (_atlasKey[i] == 0xffff) ? 0 : 1;
+        }
+        _atlasTick = 2;
+    }
 
-        for (k = 0; k < text.length(); k++)
+    // Hit, otherwise least recently used or empty slot
+    for (uint8_t i = 0; i < GLYPH_ATLAS_SIZE; i++)
+    {
+        if (_atlasKey[i] == key)
         {
-            c = text.charAt(k) - ' ';
+            _atlasUse[i] = _atlasTick;
+            return _atlasGlyph[i];
+        }
+        if (_atlasUse[i] < _atlasUse[slot])
+        {
+            slot = i;
+        }
+    }
 
-            for (i = 0; i < 12; i++)
+    // Columns of 8 rows transposed into rows of 8 columns
+    uint8_t width = _f_font.maxWidth;
+    uint8_t height = _f_font.height;
+    uint8_t bytes = (height + 7) >> 3;
+    uint8_t stride = (width + 7) >> 3;
+    const uint8_t * columns = table + (uint16_t)character * width * bytes;
+    uint8_t * rows = _atlasGlyph[slot];
+    uint8_t block[8];
+
+    for (uint8_t b = 0; b < bytes; b++)
+    {
+        for (uint8_t s = 0; s < stride; s++)
+        {
+            for (uint8_t i = 0; i < 8; i++)
             {
-                line = _f_getCharacter(c, 2 * i);
-                line1 = _f_getCharacter(c, 2 * i + 1);
+                uint8_t column = 8 * s + i;
+                block[i] = (column < width) ? reverseBits(columns[bytes * column + b]) : 0x00;
+            }
+            transpose8x8(block);
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 12 * k + i, y0 + j,    textColour);
-                    }
-                    else if (_f_fontSolid)
-                    {
-                        point(x0 + 12 * k + i, y0 + j,    backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 12 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if (_f_fontSolid)
-                    {
-                        point(x0 + 12 * k + i, y0 + 8 + j, backColour);
-                    }
-                }
+            for (uint8_t j = 0; (j < 8) and (8 * b + j < height); j++)
+            {
+                rows[(8 * b + j) * stride + s] = block[j];
             }
         }
     }
-#if (MAX_FONT_SIZE > 3)
-    else if (_f_fontSize == 3)
+
+    _atlasKey[slot] = key;
+    _atlasUse[slot] = _atlasTick;
+    return rows;
+}
+#endif // GLYPH_ATLAS_SIZE
+
+void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
+                             String text,
+                             uint16_t textColour,
+                             uint16_t backColour)
+{
+    gText(x0, y0, text.c_str(), textColour, backColour);
+}
+
+void hV_Screen_Buffer::gTextf(uint16_t x0, uint16_t y0,
+                              uint16_t textColour,
+                              uint16_t backColour,
+                              const char * format, ...)
+{
+    // Bounded buffer on the stack
+    char buffer[TEXT_BUFFER_SIZE];
+
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    if (length > 0)
+    {
+        gText(x0, y0, buffer, textColour, backColour);
+    }
+}
+
+void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
+                             const char * text,
+                             uint16_t textColour,
+                             uint16_t backColour)
+{
+    _setText(x0, y0, text, strlen(text), textColour, backColour);
+}
+
+void hV_Screen_Buffer::setTextField(field_s & field, uint16_t x0, uint16_t y0, uint8_t length,
+                                    uint16_t textColour,
+                                    uint16_t backColour)
+{
+    field.x0 = x0;
+    field.y0 = y0;
+    field.textColour = textColour;
+    field.backColour = backColour;
+    field.length = min(length, TEXT_FIELD_SIZE);
+    field.fontSize = _f_fontSize;
+    field.fontScale = _f_fontScale;
+    field.flagDrawn = false;
+    memset(field.text, ' ', sizeof(field.text));
+}
+
+uint8_t hV_Screen_Buffer::updateTextField(field_s & field, String text)
+{
+    return updateTextField(field, text.c_str());
+}
+
+uint8_t hV_Screen_Buffer::updateTextField(field_s & field, const char * text)
+{
+    // Font of the field, monospaced and solid
+    uint8_t fontSize = _f_fontSize;
+    uint8_t fontScale = _f_fontScale;
+    bool fontSolid = _f_fontSolid;
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    bool fontProportional = _f_fontProportional;
+    _f_fontProportional = false;
+#endif // PROPORTIONAL_MODE
+    _f_selectFont(field.fontSize);
+    _f_fontScale = field.fontScale;
+    _f_fontSolid = true;
+
+    uint16_t width = _f_font.maxWidth * _f_fontScale;
+    uint16_t length = strlen(text);
+    uint16_t index = 0;
+    uint8_t result = 0;
+
+    for (uint8_t k = 0; k < field.length; k++)
     {
-        for (k = 0; k < text.length(); k++)
+        // Spaces after the end of text
+        char character = ' ';
+        if (index < length)
         {
-            c = text.charAt(k) - ' ';
-            for (i = 0; i < 16; i++)
+            character = (char)_f_getCode(decodeUTF8(text, length, index));
+        }
+
+        // Changed cells only
+        if ((not field.flagDrawn) or (character != field.text[k]))
+        {
+            _setText(field.x0 + width * k, field.y0, &character, 1, field.textColour, field.backColour);
+            field.text[k] = character;
+            result++;
+        }
+    }
+    field.flagDrawn = true;
+
+    // Font restored
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    _f_fontProportional = fontProportional;
+#endif // PROPORTIONAL_MODE
+    _f_selectFont(fontSize);
+    _f_fontScale = fontScale;
+    _f_fontSolid = fontSolid;
+
+    return result;
+}
+
+uint16_t hV_Screen_Buffer::gTextBox(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                                    String text,
+                                    uint8_t options,
+                                    uint16_t textColour,
+                                    uint16_t backColour)
+{
+    return gTextBox(x0, y0, dx, dy, text.c_str(), options, textColour, backColour);
+}
+
+uint16_t hV_Screen_Buffer::gTextBox(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                                    const char * text,
+                                    uint8_t options,
+                                    uint16_t textColour,
+                                    uint16_t backColour)
+{
+    // Horizontal ellipsis, U+2026
+    const char * ellipsis = "\xe2\x80\xa6";
+    uint16_t length = strlen(text);
+    uint16_t sizeY = _f_characterSizeY();
+    uint16_t stepY = sizeY + _f_fontSpaceY;
+
+    if ((dx == 0) or (dy < sizeY))
+    {
+        return 0;
+    }
+
+    uint16_t lines = (dy + _f_fontSpaceY) / stepY;
+    uint16_t index = 0;
+    uint16_t y = y0;
+
+    for (uint16_t line = 0; (line < lines) and (index < length); line++)
+    {
+        // Line measured and broken in one pass
+        uint16_t next = 0;
+        uint16_t width = 0;
+        uint16_t end = index + _f_getLineBreak(text + index, length - index, dx, next, width);
+        next += index;
+        bool flagEllipsis = false;
+
+        // Last line, with remaining text
+        if ((options & TEXT_ELLIPSIS) and (line == lines - 1) and (next < length))
+        {
+            uint16_t sizeEllipsis = _f_stringSizeX(ellipsis, 3);
+            if (sizeEllipsis <= dx)
             {
-                line  = _f_getCharacter(c, 3 * i);
-                line1 = _f_getCharacter(c, 3 * i + 1);
-                line2 = _f_getCharacter(c, 3 * i + 2);
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + j,     textColour);
-                    }
-                    else if (_f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + j,     backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + 8 + j,  textColour);
-                    }
-                    else if (_f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + 8 + j,  backColour);
-                    }
-                    if (bitRead(line2, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + 16 + j, textColour);
-                    }
-                    else if (_f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + 16 + j, backColour);
-                    }
-                }
+                end = index + _f_stringLengthToFitX(text + index, end - index, dx - sizeEllipsis);
+                width = _f_stringSizeX(text + index, end - index) + sizeEllipsis;
+                flagEllipsis = true;
             }
         }
+
+        // Line wider than box, eg. single character, left-aligned
+        uint16_t x = x0;
+        switch ((width < dx) ? (options & TEXT_ALIGN_MASK) : TEXT_ALIGN_LEFT)
+        {
+            case TEXT_ALIGN_CENTER:
+
+                x += (dx - width) / 2;
+                break;
+
+            case TEXT_ALIGN_RIGHT:
+
+                x += dx - width;
+                break;
+
+            default:
+
+                break;
+        }
+
+        _setText(x, y, text + index, end - index, textColour, backColour);
+        if (flagEllipsis)
+        {
+            _setText(x + width - _f_stringSizeX(ellipsis, 3), y, ellipsis, 3, textColour, backColour);
+        }
+
+        // Bytes replaced by the ellipsis left for the next box
+        index = flagEllipsis ? end : next;
+        y += stepY;
+    }
+
+    return index;
+}
+
+void hV_Screen_Buffer::_setText(uint16_t x0, uint16_t y0,
+                                const char * text, uint16_t length,
+                                uint16_t textColour,
+                                uint16_t backColour)
+#if (FONT_MODE == USE_FONT_TERMINAL)
+{
+#if (FONT_STORAGE == USE_FONT_PACKED)
+    // Packed tables, decoded by blocks of columns
+    _setColumnText(x0, y0, text, length, textColour, backColour);
+#else
+    // Scaled text, expanded by blocks of columns
+    if (_f_fontScale > 1)
+    {
+        _setColumnText(x0, y0, text, length, textColour, backColour);
+        return;
+    }
+
+    // Table resolved once per string
+    const uint8_t * table = _f_getCharacterTable();
+    if (table == 0)
+    {
+        return;
+    }
+
+    // Columns of (height + 7) / 8 bytes, top row as LSB
+    uint8_t width = _f_font.maxWidth;
+    uint16_t bytes = width * ((_f_font.height + 7) >> 3);
+    bitmap_s glyph = {table, 0, 0, width, _f_font.height,
+                      BITMAP_COLUMN | BITMAP_LSB, (uint8_t)(_f_fontSolid ? BITMAP_OPAQUE : BITMAP_TRANSPARENT),
+                      textColour, backColour
+                     };
+
+    // UTF-8 decoded character by character
+    uint16_t index = 0;
+
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    if (_f_fontProportional)
+    {
+        // Columns with set pixels, then space
+        uint8_t columnBytes = (_f_font.height + 7) >> 3;
+        int16_t x = x0;
+        uint8_t previous = 0;
+
+        while (index < length)
+        {
+            uint8_t character = _f_getCode(decodeUTF8(text, length, index));
+            uint8_t c = character - _f_font.first;
+            const width_s & size = _f_fontWidths[c];
+
+            if ((previous > 0) and (_f_fontKerningNumber > 0))
+            {
+                x += _f_getKerning(previous, character);
+            }
+            previous = character;
+
+            glyph.data = table + c * bytes + size.index * columnBytes;
+            glyph.sizeX = size.pixel;
+            _clipBitmap(x, y0, glyph);
+            x += size.pixel;
+
+            if ((_f_fontSolid) and (_f_fontSpaceX > 0))
+            {
+                _clipRectangle(x, y0, x + _f_fontSpaceX - 1, y0 + _f_font.height - 1, backColour);
+            }
+            x += _f_fontSpaceX;
+        }
+        return;
+    }
+#endif // PROPORTIONAL_MODE
+
+#if (GLYPH_ATLAS_SIZE > 0)
+    bool flagAtlas = false;
+#endif // GLYPH_ATLAS_SIZE
+
+    // Rows of pixels match the bytes of the frame-buffer
+    if (_getNativeFormat() == BITMAP_ROW)
+    {
+#if (FONT_ROWS_ORIENTATIONS > 0)
+        if (bitRead(FONT_ROWS_ORIENTATIONS, _orientation))
+        {
+            // Tables transposed at compilation
+            table = _f_getCharacterRows();
+            bytes = ((width + 7) >> 3) * _f_font.height;
+            glyph.format = BITMAP_ROW | BITMAP_MSB;
+        }
+        else
+#endif // FONT_ROWS_ORIENTATIONS
+        {
+#if (GLYPH_ATLAS_SIZE > 0)
+            // Glyphs transposed at run-time
+            flagAtlas = true;
+            glyph.format = BITMAP_ROW | BITMAP_MSB;
+#endif // GLYPH_ATLAS_SIZE
+        }
+    }
+
+    int16_t x = x0;
+    while (index < length)
+    {
+        uint8_t c = _f_getCode(decodeUTF8(text, length, index)) - _f_font.first;
+#if (GLYPH_ATLAS_SIZE > 0)
+        if (flagAtlas)
+        {
+            glyph.data = _getAtlasGlyph(table, c);
+        }
+        else
+#endif // GLYPH_ATLAS_SIZE
+        {
+            glyph.data = table + c * bytes;
+        }
+        _clipBitmap(x, y0, glyph);
+        x += width;
     }
-#endif // end MAX_FONT_SIZE > 3
-#endif // end MAX_FONT_SIZE > 2
-#endif // end MAX_FONT_SIZE > 1
-#endif // end MAX_FONT_SIZE > 0
+#endif // FONT_STORAGE
 }
 #endif // FONT_MODE
@@ -48,10 +48,58 @@
 #error FONT_MODE not defined
 #endif // FONT_MODE
 
+///
+/// @brief Maximum number of edges on a line for solid polygon()
+/// @note Crossings are allocated on the stack, points are not limited
+///
+#ifndef MAX_POLYGON_CROSSINGS
+#define MAX_POLYGON_CROSSINGS 16
+#endif // MAX_POLYGON_CROSSINGS
+
+///
+/// @brief Structure for bitmap
+/// @details 1 bit per pixel, one or two planes, with optional mask
+/// @note Each row (BITMAP_ROW) or column (BITMAP_COLUMN) starts on a new byte
+///
+struct bitmap_s
+{
+    const uint8_t * data; ///< first plane, or black plane
+    const uint8_t * red; ///< red plane, 0 = single plane
+    const uint8_t * mask; ///< mask for BITMAP_MASKED
+    uint16_t sizeX; ///< width in pixels
+    uint16_t sizeY; ///< height in pixels
+    uint8_t format; ///< BITMAP_ROW or BITMAP_COLUMN, and BITMAP_MSB or BITMAP_LSB
+    uint8_t mode; ///< BITMAP_OPAQUE, BITMAP_TRANSPARENT or BITMAP_MASKED
+    uint16_t frontColour; ///< colour for set pixels, or for black plane
+    uint16_t backColour; ///< colour for clear pixels
+};
+
+///
+/// @brief Structure for text field
+/// @details Displayed characters, font and colours, for incremental update
+/// @note Set with setTextField(), updated with updateTextField()
+///
+struct field_s
+{
+    uint16_t x0; ///< top left coordinate, x-axis
+    uint16_t y0; ///< top left coordinate, y-axis
+    uint16_t textColour; ///< colour for text
+    uint16_t backColour; ///< colour for background
+    uint8_t length; ///< number of characters, up to TEXT_FIELD_SIZE
+    uint8_t fontSize; ///< font
+    uint8_t fontScale; ///< scale of font
+    bool flagDrawn; ///< false = whole field to be drawn
+    char text[TEXT_FIELD_SIZE]; ///< characters of the font, as displayed
+};
+
 ///
 /// @brief Generic class for buffered LCD
 ///
+#if (USE_hV_SCREEN == USE_hV_SCREEN_STATIC)
+#warning USE_hV_SCREEN == USE_hV_SCREEN_STATIC
+#else
 #warning USE_hV_SCREEN == USE_hV_SCREEN_SELF
+#endif // USE_hV_SCREEN
 #warning FONT_MODE == USE_FONT_TERMINAL
 class hV_Screen_Buffer : protected hV_Font_Terminal
 {
@@ -108,6 +156,37 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     uint8_t getOrientation();
 
+    ///
+    /// @brief Set viewport
+    /// @param x0 origin of the viewport, x-axis
+    /// @param y0 origin of the viewport, y-axis
+    /// @param dx width of the viewport
+    /// @param dy height of the viewport
+    /// @note Coordinates of all primitives are then relative to (x0, y0),
+    /// and drawing is clipped to the viewport
+    /// @note dx = 0 or dy = 0 gives an empty viewport, nothing drawn
+    /// @note setOrientation() resets the viewport
+    ///
+    virtual void setViewport(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief Reset viewport to the whole screen
+    /// @note Origin is (0, 0) and clip window is the screen
+    ///
+    virtual void resetViewport();
+
+    ///
+    /// @brief Set clip window
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @note Coordinates are relative to the viewport origin,
+    /// and the clip window is limited to the screen
+    /// @note Pixels outside the clip window are not drawn
+    ///
+    virtual void setClip(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
     ///
     /// @brief Screen size, x-axis
     /// @return horizontal size of the screen, in pixels
@@ -156,6 +235,18 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour);
 
+    ///
+    /// @brief Draw ellipse
+    /// @param x0 center, point coordinate, x-axis
+    /// @param y0 center, point coordinate, y-axis
+    /// @param radiusX radius, x-axis
+    /// @param radiusY radius, y-axis
+    /// @param colour 16-bit colour
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual void ellipse(uint16_t x0, uint16_t y0, uint16_t radiusX, uint16_t radiusY, uint16_t colour);
+
     ///
     /// @brief Draw line, rectangle coordinates
     /// @param x1 top left coordinate, x-axis
@@ -201,6 +292,20 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour);
 
+    ///
+    /// @brief Draw polygon
+    /// @param pointsX array of point coordinates, x-axis
+    /// @param pointsY array of point coordinates, y-axis
+    /// @param number number of points
+    /// @param colour 16-bit colour
+    /// @note The last point is joined to the first one
+    /// @note Solid polygons are filled with the even-odd rule, outline included.
+    /// @n Polygons with more than MAX_POLYGON_CROSSINGS edges on a line are drawn as outline
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual void polygon(const uint16_t * pointsX, const uint16_t * pointsY, uint8_t number, uint16_t colour);
+
     ///
     /// @brief Draw rectangle, rectangle coordinates
     /// @param x1 top left coordinate, x-axis
@@ -225,6 +330,33 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t colour);
 
+    ///
+    /// @brief Draw rounded rectangle, rectangle coordinates
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param radius radius of the corners
+    /// @param colour 16-bit colour
+    /// @note radius is limited to half the smallest side
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual void roundedRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t radius, uint16_t colour);
+
+    ///
+    /// @brief Draw rounded rectangle, vector coordinates
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param dx length, x-axis
+    /// @param dy height, y-axis
+    /// @param radius radius of the corners
+    /// @param colour 16-bit colour
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual void dRoundedRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t radius, uint16_t colour);
+
     ///
     /// @brief Draw pixel
     /// @param x1 point coordinate, x-axis
@@ -235,6 +367,47 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void point(uint16_t x1, uint16_t y1, uint16_t colour);
 
+    ///
+    /// @brief Draw bitmap, 1 bit per pixel
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param dx width of the bitmap, x-axis
+    /// @param dy height of the bitmap, y-axis
+    /// @param data bitmap
+    /// @param format BITMAP_ROW or BITMAP_COLUMN, and BITMAP_MSB or BITMAP_LSB, default = BITMAP_ROW | BITMAP_MSB
+    /// @param mode BITMAP_OPAQUE, BITMAP_TRANSPARENT or BITMAP_MASKED, default = BITMAP_TRANSPARENT
+    /// @param frontColour 16-bit colour for set pixels, default = black
+    /// @param backColour 16-bit colour for clear pixels, default = white
+    /// @param mask mask for BITMAP_MASKED, same format and size as bitmap
+    /// @note Adafruit GFX bitmaps are BITMAP_ROW | BITMAP_MSB, XBM bitmaps are BITMAP_ROW | BITMAP_LSB
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual void bitmap(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint8_t * data,
+                        uint8_t format = BITMAP_ROW | BITMAP_MSB, uint8_t mode = BITMAP_TRANSPARENT,
+                        uint16_t frontColour = myColours.black, uint16_t backColour = myColours.white,
+                        const uint8_t * mask = 0);
+
+    ///
+    /// @brief Draw bitmap, black and red planes
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param dx width of the bitmap, x-axis
+    /// @param dy height of the bitmap, y-axis
+    /// @param dataBlack black plane
+    /// @param dataRed red plane
+    /// @param format BITMAP_ROW or BITMAP_COLUMN, and BITMAP_MSB or BITMAP_LSB, default = BITMAP_ROW | BITMAP_MSB
+    /// @param mode BITMAP_OPAQUE, BITMAP_TRANSPARENT or BITMAP_MASKED, default = BITMAP_OPAQUE
+    /// @param mask mask for BITMAP_MASKED, same format and size as bitmap
+    /// @note Pixels set on black plane are black, otherwise red if set on red plane, otherwise white
+    /// @note BITMAP_TRANSPARENT leaves white pixels unchanged
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual void bitmapBlackRed(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, const uint8_t * dataBlack, const uint8_t * dataRed,
+                                uint8_t format = BITMAP_ROW | BITMAP_MSB, uint8_t mode = BITMAP_OPAQUE,
+                                const uint8_t * mask = 0);
+
     /// @}
 
     /// @name Text
@@ -279,6 +452,35 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void setFontSpaceY(uint8_t number = 1);
 
+    ///
+    /// @brief Set scale of text
+    /// @param scale 1..4, default = 1
+    /// @note Characters and spaces are 2, 3 or 4 times larger, with same font
+    /// @n @b More: @ref Fonts
+    ///
+    virtual void setFontScale(uint8_t scale = 1);
+
+#if (PROPORTIONAL_MODE == USE_PROPORTIONAL_WIDTHS)
+    ///
+    /// @brief Set proportional or monospaced text
+    /// @param flag default = true = proportional, false = monospaced
+    /// @note Proportional characters use their columns with set pixels,
+    /// plus setFontSpaceX() pixels
+    /// @n @b More: @ref Fonts
+    ///
+    virtual void setFontProportional(bool flag = true);
+
+    ///
+    /// @brief Set kerning pairs for proportional text
+    /// @param table kerning pairs, sorted by first then second character, 0 = none
+    /// @param number number of kerning pairs
+    /// @note The table is not copied and should remain available
+    /// @note Negative offsets make solid characters overlap, the second erasing the first
+    /// @n @b More: @ref Fonts
+    ///
+    virtual void setFontKerning(const kerning_s * table, uint16_t number);
+#endif // PROPORTIONAL_MODE
+
     ///
     /// @brief Character size, x-axis
     /// @param character character to evaluate, default = 0 = font general size
@@ -301,20 +503,40 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
 
     ///
     /// @brief String size, x-axis
-    /// @param text string to evaluate
+    /// @param text UTF-8 string to evaluate
     /// @return horizontal size of the string for current font, in pixels
     /// @n @b More: @ref Fonts
     ///
     virtual uint16_t stringSizeX(String text);
 
+    ///
+    /// @brief String size, x-axis
+    /// @param text UTF-8 null-terminated string to evaluate
+    /// @return horizontal size of the string for current font, in pixels
+    /// @note No String allocation
+    /// @n @b More: @ref Fonts
+    ///
+    virtual uint16_t stringSizeX(const char * text);
+
+    ///
+    /// @brief Number of characters to fit a size, x-axis
+    /// @param text UTF-8 string to evaluate
+    /// @param pixels number of pixels to fit in
+    /// @return number of bytes of the characters to be displayed inside the pixels
+    /// @note Same as number of characters for ASCII, to be used with String.substring()
+    /// @n @b More: @ref Fonts
+    ///
+    virtual uint16_t stringLengthToFitX(String text, uint16_t pixels);
+
     ///
     /// @brief Number of characters to fit a size, x-axis
-    /// @param text string to evaluate
+    /// @param text UTF-8 null-terminated string to evaluate
     /// @param pixels number of pixels to fit in
-    /// @return number of characters to be displayed inside the pixels
+    /// @return number of bytes of the characters to be displayed inside the pixels
+    /// @note No String allocation
     /// @n @b More: @ref Fonts
     ///
-    virtual uint8_t stringLengthToFitX(String text, uint16_t pixels);
+    virtual uint16_t stringLengthToFitX(const char * text, uint16_t pixels);
 
     ///
     /// @brief Number of fonts
@@ -328,10 +550,11 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     /// @brief Draw ASCII Text (pixel coordinates) with selection of size
     /// @param x0 point coordinate, x-axis
     /// @param y0 point coordinate, y-axis
-    /// @param text text string
+    /// @param text UTF-8 text string
     /// @param textColour 16-bit colour, default = white
     /// @param backColour 16-bit colour, default = black
     /// @note Previously gText() with ix and iy
+    /// @note UTF-8 decoded directly to the characters of the font, without utf2iso()
     ///
     /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
     ///
@@ -339,6 +562,117 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
                        String text,
                        uint16_t textColour = myColours.black,
                        uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates), null-terminated string
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text UTF-8 null-terminated text string
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @note No String allocation, selected for string literals
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    virtual void gText(uint16_t x0, uint16_t y0,
+                       const char * text,
+                       uint16_t textColour = myColours.black,
+                       uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw paragraph in box (pixel coordinates)
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param dx width of box, x-axis
+    /// @param dy height of box, y-axis
+    /// @param text UTF-8 text string
+    /// @param options TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER or TEXT_ALIGN_RIGHT, combined with TEXT_ELLIPSIS
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @return number of bytes of text displayed, length of text if complete
+    /// @note Lines broken between words, or inside words longer than the box, and on LF
+    /// @n Lines spaced by setFontSpaceY()
+    /// @n With TEXT_ELLIPSIS, last line ends with … if the text doesn't fit in the box
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    virtual uint16_t gTextBox(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                              String text,
+                              uint8_t options = TEXT_ALIGN_LEFT,
+                              uint16_t textColour = myColours.black,
+                              uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw paragraph in box (pixel coordinates), null-terminated string
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param dx width of box, x-axis
+    /// @param dy height of box, y-axis
+    /// @param text UTF-8 null-terminated text string
+    /// @param options TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER or TEXT_ALIGN_RIGHT, combined with TEXT_ELLIPSIS
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @return number of bytes of text displayed, length of text if complete
+    /// @note No String allocation
+    ///
+    virtual uint16_t gTextBox(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
+                              const char * text,
+                              uint8_t options = TEXT_ALIGN_LEFT,
+                              uint16_t textColour = myColours.black,
+                              uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw formatted text (pixel coordinates)
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    /// @param format format with standard codes, see formatString()
+    /// @param ... list of values
+    /// @note Formatted into a buffer of TEXT_BUFFER_SIZE bytes on the stack, longer text truncated
+    /// @n No String allocation
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    void gTextf(uint16_t x0, uint16_t y0,
+                uint16_t textColour,
+                uint16_t backColour,
+                const char * format, ...);
+
+    ///
+    /// @brief Set text field
+    /// @param[out] field text field
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param length number of characters, up to TEXT_FIELD_SIZE
+    /// @param textColour 16-bit colour, default = white
+    /// @param backColour 16-bit colour, default = black
+    /// @note The field uses the font and the scale selected when set, monospaced and solid
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    void setTextField(field_s & field, uint16_t x0, uint16_t y0, uint8_t length,
+                      uint16_t textColour = myColours.black,
+                      uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Update text field
+    /// @param field text field
+    /// @param text UTF-8 text string, padded with spaces or truncated to the length of the field
+    /// @return number of characters drawn
+    /// @note Only the characters different from the displayed ones are drawn,
+    /// the whole field on first update
+    ///
+    uint8_t updateTextField(field_s & field, String text);
+
+    ///
+    /// @brief Update text field, null-terminated string
+    /// @param field text field
+    /// @param text UTF-8 null-terminated text string
+    /// @return number of characters drawn
+    /// @note No String allocation
+    ///
+    uint8_t updateTextField(field_s & field, const char * text);
     /// @}
 
   protected:
@@ -370,21 +704,217 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void _setPoint(uint16_t x1, uint16_t y1, uint16_t colour) = 0; // compulsory
 
+    ///
+    /// @brief Set horizontal span
+    /// @param x1 first point coordinate, x-axis
+    /// @param x2 last point coordinate, x-axis
+    /// @param y1 point coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @note Coordinates are absolute and within the screen
+    /// @note Default calls _setPoint() for each pixel
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    virtual void _setSpanX(uint16_t x1, uint16_t x2, uint16_t y1, uint16_t colour);
+
+    ///
+    /// @brief Set vertical span
+    /// @param x1 point coordinate, x-axis
+    /// @param y1 first point coordinate, y-axis
+    /// @param y2 last point coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @note Coordinates are absolute and within the screen
+    /// @note Default calls _setPoint() for each pixel
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    virtual void _setSpanY(uint16_t x1, uint16_t y1, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Set filled rectangle
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis
+    /// @param y2 bottom right coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @note Coordinates are absolute, within the screen and sorted, x1 <= x2 and y1 <= y2
+    /// @note Default calls _setSpanY() for each column
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    virtual void _setRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Set bitmap
+    /// @param x0 top left coordinate of the bitmap, x-axis, may be negative
+    /// @param y0 top left coordinate of the bitmap, y-axis, may be negative
+    /// @param x1 top left coordinate of the area to draw, x-axis
+    /// @param y1 top left coordinate of the area to draw, y-axis
+    /// @param x2 bottom right coordinate of the area to draw, x-axis
+    /// @param y2 bottom right coordinate of the area to draw, y-axis
+    /// @param bitmap bitmap
+    /// @note Coordinates are absolute, area within the screen and within the bitmap
+    /// @note Default calls _setPoint() for each pixel
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    virtual void _setBitmap(int16_t x0, int16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, const bitmap_s & bitmap);
+
+    ///
+    /// @brief Get bitmap format matching the bytes of the frame-buffer
+    /// @return BITMAP_ROW or BITMAP_COLUMN, for current orientation
+    /// @note Default is BITMAP_COLUMN, as the Terminal fonts
+    /// @note gText() uses the glyph atlas for BITMAP_ROW
+    ///
+    virtual uint8_t _getNativeFormat();
+
+    ///
+    /// @brief Get pixel of bitmap plane
+    /// @param plane bitmap plane, data, red or mask
+    /// @param bitmap bitmap for size and format
+    /// @param x1 coordinate in bitmap, x-axis
+    /// @param y1 coordinate in bitmap, y-axis
+    /// @return true if pixel is set
+    ///
+    bool _getBitmapPixel(const uint8_t * plane, const bitmap_s & bitmap, uint16_t x1, uint16_t y1);
+
+    ///
+    /// @brief Get up to 8 consecutive pixels of bitmap plane along the major axis
+    /// @param plane bitmap plane, data, red or mask
+    /// @param bitmap bitmap for size and format
+    /// @param x1 coordinate of first pixel in bitmap, x-axis
+    /// @param y1 coordinate of first pixel in bitmap, y-axis
+    /// @param step +1 or -1, along x-axis for BITMAP_ROW, along y-axis for BITMAP_COLUMN
+    /// @param count number of pixels, 1..8
+    /// @return pixels, first pixel on bit 7
+    ///
+    uint8_t _getBitmapBits(const uint8_t * plane, const bitmap_s & bitmap, int16_t x1, int16_t y1, int8_t step, uint8_t count);
+
+    ///
+    /// @brief Get block of up to 8 x 8 pixels of bitmap plane
+    /// @param plane bitmap plane, data, red or mask
+    /// @param bitmap bitmap for size and format
+    /// @param x1 coordinate of first pixel in bitmap, x-axis
+    /// @param y1 coordinate of first pixel in bitmap, y-axis
+    /// @param rowX step in bitmap for next byte, x-axis
+    /// @param rowY step in bitmap for next byte, y-axis
+    /// @param bitX step in bitmap for next bit, x-axis
+    /// @param bitY step in bitmap for next bit, y-axis
+    /// @param rows number of bytes, 1..8
+    /// @param bits number of bits per byte, 1..8
+    /// @param[out] block 8 bytes, first bit on bit 7
+    /// @note Bytes read along the major axis of the bitmap, transposed with transpose8x8() if needed
+    ///
+    void _getBitmapBlock(const uint8_t * plane, const bitmap_s & bitmap, int16_t x1, int16_t y1,
+                         int8_t rowX, int8_t rowY, int8_t bitX, int8_t bitY,
+                         uint8_t rows, uint8_t bits, uint8_t * block);
+
+    ///
+    /// @brief Clip bitmap and call _setBitmap()
+    /// @param x0 top left coordinate, x-axis, relative to origin
+    /// @param y0 top left coordinate, y-axis, relative to origin
+    /// @param bitmap bitmap
+    ///
+    void _clipBitmap(int16_t x0, int16_t y0, const bitmap_s & bitmap);
+
     // Write and Read
 
     // Other functions
-    // required by triangle()
+    // required by triangle() and polygon()
+    ///
+    /// @brief Fill polygon with scanlines
+    /// @param pointsX array of point coordinates, x-axis
+    /// @param pointsY array of point coordinates, y-axis
+    /// @param number number of points
+    /// @param colour 16-bit colour
+    /// @note Edges crossed for each line, spans extended to the run of each edge as drawn by line(),
+    /// merged, then one _clipSpanX() per span
+    ///
+    void _fillPolygon(const uint16_t * pointsX, const uint16_t * pointsY, uint8_t number, uint16_t colour);
+
+    // required by circle(), ellipse() and roundedRectangle()
+    ///
+    /// @brief Draw four quarters of ellipse with scanlines
+    /// @param xLeft center of the left quarters, x-axis
+    /// @param xRight center of the right quarters, x-axis
+    /// @param yTop center of the top quarters, y-axis
+    /// @param yBottom center of the bottom quarters, y-axis
+    /// @param radiusX radius, x-axis
+    /// @param radiusY radius, y-axis
+    /// @param colour 16-bit colour
+    /// @note Each scanline is emitted once, filled if _penSolid, outline otherwise
+    /// @note Rows between yTop and yBottom are not drawn
+    ///
+    void _setQuarters(int16_t xLeft, int16_t xRight, int16_t yTop, int16_t yBottom, uint16_t radiusX, uint16_t radiusY, uint16_t colour);
+
+    ///
+    /// @brief Walk clipped line with Bresenham
+    /// @param x1 first point coordinate, x-axis, relative to origin
+    /// @param y1 first point coordinate, y-axis, relative to origin
+    /// @param x2 second point coordinate, x-axis, relative to origin
+    /// @param y2 second point coordinate, y-axis, relative to origin
+    /// @param sink called with absolute coordinates of each point within the clip window
+    /// @note Line neither horizontal nor vertical
+    /// @note Shared by line() of hV_Screen_Buffer and hV_Screen_Static
+    ///
+    template <class S>
+    void _walkLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, S sink);
+
+    ///
+    /// @brief Walk circle outline with midpoint
+    /// @param x0 center coordinate, x-axis, relative to origin
+    /// @param y0 center coordinate, y-axis, relative to origin
+    /// @param radius radius
+    /// @param sink called with coordinates of each point, relative to origin, not clipped
+    /// @note Shared by circle() of hV_Screen_Buffer and hV_Screen_Static
+    ///
+    template <class S>
+    void _walkCircle(uint16_t x0, uint16_t y0, uint16_t radius, S sink);
+
+    // required by clipping
+    ///
+    /// @brief Get Cohen-Sutherland code of point
+    /// @param x1 x coordinate, relative to origin
+    /// @param y1 y coordinate, relative to origin
+    /// @return 0 = inside, otherwise 0x01 = left, 0x02 = right, 0x04 = top, 0x08 = bottom
+    /// @note Two points with common bits define a box outside the clip window
+    ///
+    uint8_t _getClipCode(int16_t x1, int16_t y1);
+
+    ///
+    /// @brief Translate coordinates and check within clip window
+    /// @param[out] x1 x coordinate, relative to origin, then absolute
+    /// @param[out] y1 y coordinate, relative to origin, then absolute
+    /// @return false = success, true = error
     ///
-    /// @brief Triangle utility
+    bool _clipCoordinates(uint16_t & x1, uint16_t & y1);
+
+    ///
+    /// @brief Set horizontal span, clipped
     /// @param x1 first point coordinate, x-axis
+    /// @param x2 last point coordinate, x-axis, x1 <= x2
+    /// @param y1 point coordinate, y-axis
+    /// @param colour 16-bit colour
+    /// @note Coordinates are relative to origin, and trimmed to the clip window
+    ///
+    void _clipSpanX(int16_t x1, int16_t x2, int16_t y1, uint16_t colour);
+
+    ///
+    /// @brief Set vertical span, clipped
+    /// @param x1 point coordinate, x-axis
     /// @param y1 first point coordinate, y-axis
-    /// @param x2 second point coordinate, x-axis
-    /// @param y2 second point coordinate, y-axis
-    /// @param x3 third point coordinate, x-axis
-    /// @param y3 third point coordinate, y-axis
+    /// @param y2 last point coordinate, y-axis, y1 <= y2
+    /// @param colour 16-bit colour
+    /// @note Coordinates are relative to origin, and trimmed to the clip window
+    ///
+    void _clipSpanY(int16_t x1, int16_t y1, int16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Set filled rectangle, clipped
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis, x1 <= x2
+    /// @param y2 bottom right coordinate, y-axis, y1 <= y2
     /// @param colour 16-bit colour
+    /// @note Coordinates are relative to origin, and trimmed to the clip window
     ///
-    void _triangleArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour);
+    void _clipRectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t colour);
 
     // required by gText()
     ///
@@ -395,12 +925,177 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     uint8_t _getCharacter(uint8_t character, uint8_t index);
 
+    ///
+    /// @brief Draw text
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text UTF-8 text string
+    /// @param length length of text, in bytes
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    ///
+    void _setText(uint16_t x0, uint16_t y0,
+                  const char * text, uint16_t length,
+                  uint16_t textColour, uint16_t backColour);
+
+    ///
+    /// @brief Draw text column by column, packed or scaled
+    /// @param x0 point coordinate, x-axis, relative to origin
+    /// @param y0 point coordinate, y-axis, relative to origin
+    /// @param text UTF-8 text string
+    /// @param length length of text, in bytes
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    /// @note Columns decoded, expanded with expandBits() and drawn by blocks of up to 8 columns
+    ///
+    void _setColumnText(int16_t x0, int16_t y0, const char * text, uint16_t length, uint16_t textColour, uint16_t backColour);
+
+#if (GLYPH_ATLAS_SIZE > 0)
+    ///
+    /// @brief Get glyph from atlas, rows of pixels
+    /// @param table table of characters, from _f_getCharacterTable()
+    /// @param character character 0~223, from 32~255
+    /// @return glyph as BITMAP_ROW | BITMAP_MSB
+    /// @note Glyph transposed on first use, least recently used glyph evicted
+    ///
+    const uint8_t * _getAtlasGlyph(const uint8_t * table, uint8_t character);
+#endif // GLYPH_ATLAS_SIZE
+
     // Variables provided by hV_Screen_Virtual
     bool _penSolid;
     uint16_t _screenWidth, _screenHeigth, _screenDiagonal;
     uint8_t _orientation;
     uint16_t _screenColourBits;
+    int16_t _originX, _originY; // viewport origin
+    int16_t _clipX1, _clipY1, _clipX2, _clipY2; // clip window, absolute
+
+#if (GLYPH_ATLAS_SIZE > 0)
+    // Glyph atlas, up to 16 x 24 pixels per glyph
+    uint8_t _atlasGlyph[GLYPH_ATLAS_SIZE][48];
+    uint16_t _atlasKey[GLYPH_ATLAS_SIZE]; // font << 8 | character, 0xffff = empty
+    uint16_t _atlasUse[GLYPH_ATLAS_SIZE]; // tick of last use, 0 = empty
+    uint16_t _atlasTick;
+#endif // GLYPH_ATLAS_SIZE
     /// @endcond
 };
 
+template <class S>
+void hV_Screen_Buffer::_walkLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, S sink)
+{
+    // Cohen-Sutherland codes, trivial rejection
+    uint8_t code1 = _getClipCode(x1, y1);
+    uint8_t code2 = _getClipCode(x2, y2);
+    if (code1 & code2)
+    {
+        return;
+    }
+
+    // Absolute coordinates, major axis along x
+    int32_t ax1 = (int32_t)x1 + _originX;
+    int32_t ax2 = (int32_t)x2 + _originX;
+    int32_t ay1 = (int32_t)y1 + _originY;
+    int32_t ay2 = (int32_t)y2 + _originY;
+    int32_t majorMin = _clipX1;
+    int32_t majorMax = _clipX2;
+    int32_t minorMin = _clipY1;
+    int32_t minorMax = _clipY2;
+
+    bool flag = abs(ay2 - ay1) > abs(ax2 - ax1);
+    if (flag)
+    {
+        swap(ax1, ay1);
+        swap(ax2, ay2);
+        swap(majorMin, minorMin);
+        swap(majorMax, minorMax);
+    }
+
+    if (ax1 > ax2)
+    {
+        swap(ax1, ax2);
+        swap(ay1, ay2);
+    }
+
+    int32_t dx = ax2 - ax1;
+    int32_t dy = abs(ay2 - ay1);
+    int32_t ystep = (ay1 < ay2) ? 1 : -1;
+    int32_t first = 0;
+    int32_t last = dx;
+
+    // Partial line, steps limited to the clip window on the major axis
+    if (code1 | code2)
+    {
+        first = max(majorMin - ax1, (int32_t)0);
+        last = min(majorMax - ax1, dx);
+    }
+
+    // Same error term as the unclipped line at the first step
+    uint32_t t = (uint32_t)first * dy + dx - 1 - dx / 2;
+    int32_t y = ay1 + ystep * (int32_t)(t / dx);
+    int32_t err = dx - 1 - (int32_t)(t % dx);
+
+    for (int32_t x = ax1 + first; x <= ax1 + last; x++)
+    {
+        if ((y >= minorMin) and (y <= minorMax))
+        {
+            if (flag)
+            {
+                sink(y, x);
+            }
+            else
+            {
+                sink(x, y);
+            }
+        }
+        else if ((ystep > 0) xor (y < minorMin))
+        {
+            break; // past the clip window
+        }
+
+        err -= dy;
+        if (err < 0)
+        {
+            y += ystep;
+            err += dx;
+        }
+    }
+}
+
+template <class S>
+void hV_Screen_Buffer::_walkCircle(uint16_t x0, uint16_t y0, uint16_t radius, S sink)
+{
+    int16_t f = 1 - radius;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * radius;
+    int16_t x = 0;
+    int16_t y = radius;
+
+    sink(x0, y0 + radius);
+    sink(x0, y0 - radius);
+    sink(x0 + radius, y0);
+    sink(x0 - radius, y0);
+
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        sink(x0 + x, y0 + y);
+        sink(x0 - x, y0 + y);
+        sink(x0 + x, y0 - y);
+        sink(x0 - x, y0 - y);
+        sink(x0 + y, y0 + x);
+        sink(x0 - y, y0 + x);
+        sink(x0 + y, y0 - x);
+        sink(x0 - y, y0 - x);
+    }
+}
+
 #endif // hV_SCREEN_BUFFER_RELEASE
@@ -0,0 +1,150 @@
+///
+/// @file hV_Screen_Static.h
+/// @brief Class Generic LCD with buffer, static binding
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @author Rei Vilo
+/// @date 16 Oct 2026
+/// @version 523
+///
+/// @copyright (c) Rei Vilo, 2010-2023
+/// @copyright Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// The highView Library Suite is shared under the Creative Commons licence Attribution-ShareAlike 4.0 International (CC BY-SA 4.0).
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+
+// SDK
+#if defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#else // Arduino general
+#include "Arduino.h"
+#endif // SDK
+
+#ifndef hV_SCREEN_STATIC_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_SCREEN_STATIC_RELEASE 523
+
+// Other libraries
+#include "hV_Screen_Buffer.h"
+
+#if (hV_SCREEN_BUFFER_RELEASE < 523)
+#error Required hV_SCREEN_BUFFER_RELEASE 523
+#endif // hV_SCREEN_BUFFER_RELEASE
+
+///
+/// @brief Generic class for buffered LCD, bound at compile time
+/// @details Curiously recurring template pattern: T is the final screen class.
+/// The per-pixel loops of line(), circle() and triangle() call T::_setPoint()
+/// directly, so the compiler can inline it.
+/// @note gText() draws glyphs as bitmaps, with one _setBitmap() call per character.
+/// @note Requires USE_hV_SCREEN == USE_hV_SCREEN_STATIC
+/// @note T declares hV_Screen_Static<T> as friend
+/// and instantiates the template in its own translation unit,
+/// where T::_setPoint() is defined.
+///
+template <class T>
+class hV_Screen_Static : public hV_Screen_Buffer
+{
+  public:
+    ///
+    /// @brief Draw line, static binding
+    /// @details Same as hV_Screen_Buffer::line()
+    ///
+    void line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
+    ///
+    /// @brief Draw circle, static binding
+    /// @details Same as hV_Screen_Buffer::circle()
+    ///
+    void circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour);
+
+    ///
+    /// @brief Draw triangle, static binding
+    /// @details Same as hV_Screen_Buffer::triangle()
+    ///
+    void triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour);
+
+  protected:
+    /// @cond
+    ///
+    /// @brief Clip and set point, static binding
+    /// @param x1 x coordinate, relative to origin
+    /// @param y1 y coordinate, relative to origin
+    /// @param colour 16-bit colour
+    ///
+    inline void _staticPoint(uint16_t x1, uint16_t y1, uint16_t colour)
+    {
+        if (_clipCoordinates(x1, y1) == false)
+        {
+            static_cast<T *>(this)->_setPoint(x1, y1, colour);
+        }
+    }
+    /// @endcond
+};
+
+template <class T>
+void hV_Screen_Static<T>::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    // Points and spans are not per-pixel
+    if ((x1 == x2) or (y1 == y2))
+    {
+        hV_Screen_Buffer::line(x1, y1, x2, y2, colour);
+        return;
+    }
+
+    T * screen = static_cast<T *>(this);
+    _walkLine((int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2, [screen, colour](int32_t x, int32_t y)
+    {
+        screen->_setPoint(x, y, colour);
+    });
+}
+
+template <class T>
+void hV_Screen_Static<T>::circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour)
+{
+    // Filled circle is drawn with spans
+    if (_penSolid)
+    {
+        hV_Screen_Buffer::circle(x0, y0, radius, colour);
+        return;
+    }
+
+    // Trivial rejection
+    if (_getClipCode((int16_t)x0 - radius, (int16_t)y0 - radius) & _getClipCode((int16_t)x0 + radius, (int16_t)y0 + radius))
+    {
+        return;
+    }
+
+    _walkCircle(x0, y0, radius, [this, colour](uint16_t x, uint16_t y)
+    {
+        _staticPoint(x, y, colour);
+    });
+}
+
+template <class T>
+void hV_Screen_Static<T>::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
+{
+    // Filled and degenerated triangles
+    if ((_penSolid) or ((x1 == x2) and (y1 == y2)) or ((x1 == x3) and (y1 == y3)) or ((x2 == x3) and (y2 == y3)))
+    {
+        hV_Screen_Buffer::triangle(x1, y1, x2, y2, x3, y3, colour);
+        return;
+    }
+
+    hV_Screen_Static<T>::line(x1, y1, x2, y2, colour);
+    hV_Screen_Static<T>::line(x2, y2, x3, y3, colour);
+    hV_Screen_Static<T>::line(x3, y3, x1, y1, colour);
+}
+
+#endif // hV_SCREEN_STATIC_RELEASE
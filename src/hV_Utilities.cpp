@@ -34,48 +34,61 @@ String formatString(const char * format, ...)
     memset(&bufferOut, 0x00, sizeof(bufferOut));
     va_list args;
     va_start(args, format);
-    vsprintf(bufferOut, format, args);
+    vsnprintf(bufferOut, sizeof(bufferOut), format, args);
 
     va_end(args);
     return String(bufferOut);
 }
 
+uint16_t formatBuffer(char * buffer, uint16_t size, const char * format, ...)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    va_list args;
+    va_start(args, format);
+    int result = vsnprintf(buffer, size, format, args);
+    va_end(args);
+
+    if (result < 0)
+    {
+        buffer[0] = 0x00;
+        return 0;
+    }
+    return (result < size) ? (uint16_t)result : size - 1;
+}
+
+static bool isTrimmed(char c)
+{
+    return (c == '\n') or (c == '\r') or (c == ' ') or (c == '\t');
+}
+
 String trimString(String text)
 {
-    String work = "";
-    bool flag = true;
-    char c;
+    uint16_t start = 0;
+    uint16_t length = trimString(text.c_str(), text.length(), start);
 
-    uint8_t index;
-    uint8_t start, end;
+    return text.substring(start, start + length);
+}
 
+uint16_t trimString(const char * text, uint16_t length, uint16_t & start)
+{
     // Upwards from start
-    index = 0;
-    flag = true;
-    while ((index < text.length()) and flag)
+    start = 0;
+    while ((start < length) and isTrimmed(text[start]))
     {
-        if ((text.charAt(index) != '\n') and (text.charAt(index) != '\r') and (text.charAt(index) != ' ') and (text.charAt(index) != '\t'))
-        {
-            flag = false;
-            start = index;
-        }
-        index++;
+        start++;
     }
 
     // Downwards from end
-    index = text.length();
-    flag = true;
-    while ((index > 0) and flag)
+    while ((length > start) and isTrimmed(text[length - 1]))
     {
-        if ((text.charAt(index) != '\n') and (text.charAt(index) != '\r') and (text.charAt(index) != ' ') and (text.charAt(index) != '\t'))
-        {
-            flag = false;
-            end = index - 1;
-        }
-        index--;
+        length--;
     }
 
-    return text.substring(start, end);
+    return length - start;
 }
 
 int32_t cos32x100(int32_t degreesX100)
@@ -246,6 +259,57 @@ String utf2iso(String s)
     return bufferOut;
 }
 
+uint32_t decodeUTF8(const char * text, uint16_t length, uint16_t & index)
+{
+    // Minimum codepoint per number of continuation bytes, against overlong sequences
+    static const uint32_t minimum[4] = { 0x00, 0x80, 0x800, 0x10000 };
+
+    uint8_t lead = (uint8_t)text[index];
+    uint8_t number = 0;
+    uint32_t result = 0;
+
+    if (lead < 0x80)
+    {
+        index++;
+        return lead;
+    }
+    else if ((lead & 0xe0) == 0xc0)
+    {
+        number = 1;
+        result = lead & 0x1f;
+    }
+    else if ((lead & 0xf0) == 0xe0)
+    {
+        number = 2;
+        result = lead & 0x0f;
+    }
+    else if ((lead & 0xf8) == 0xf0)
+    {
+        number = 3;
+        result = lead & 0x07;
+    }
+
+    if ((number > 0) and (index + number < length))
+    {
+        uint8_t i = 1;
+        while ((i <= number) and (((uint8_t)text[index + i] & 0xc0) == 0x80))
+        {
+            result = (result << 6) | ((uint8_t)text[index + i] & 0x3f);
+            i++;
+        }
+
+        if ((i > number) and (result >= minimum[number]))
+        {
+            index += number + 1;
+            return result;
+        }
+    }
+
+    // Invalid sequence, first byte as ISO-8859-1
+    index++;
+    return lead;
+}
+
 uint16_t checkRange(uint16_t value, uint16_t valueMin, uint16_t valueMax)
 {
     uint16_t localMin = min(valueMin, valueMax);
@@ -283,6 +347,12 @@ void swap(uint16_t & a, uint16_t & b)
     a = b;
     b = w;
 }
+void swap(int32_t & a, int32_t & b)
+{
+    int32_t w = a;
+    a = b;
+    b = w;
+}
 void swap(int16_t & a, int16_t & b)
 {
     int16_t w = a;
@@ -296,3 +366,59 @@ void swap(uint8_t & a, uint8_t & b)
     b = w;
 }
 
+uint8_t reverseBits(uint8_t value)
+{
+    value = ((value & 0xf0) >> 4) | ((value & 0x0f) << 4);
+    value = ((value & 0xcc) >> 2) | ((value & 0x33) << 2);
+    value = ((value & 0xaa) >> 1) | ((value & 0x55) << 1);
+    return value;
+}
+
+void transpose8x8(uint8_t * bytes)
+{
+    // Hacker's Delight, 7-3 Transposing a bit matrix
+    uint32_t x = ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
+    uint32_t y = ((uint32_t)bytes[4] << 24) | ((uint32_t)bytes[5] << 16) | ((uint32_t)bytes[6] << 8) | bytes[7];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00aa00aa;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00aa00aa;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000cccc;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000cccc;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xf0f0f0f0) | ((y >> 4) & 0x0f0f0f0f);
+    y = ((x << 4) & 0xf0f0f0f0) | (y & 0x0f0f0f0f);
+    x = t;
+
+    bytes[0] = x >> 24;
+    bytes[1] = x >> 16;
+    bytes[2] = x >> 8;
+    bytes[3] = x;
+    bytes[4] = y >> 24;
+    bytes[5] = y >> 16;
+    bytes[6] = y >> 8;
+    bytes[7] = y;
+}
+
+uint32_t expandBits(uint8_t value, uint8_t scale)
+{
+    // Nibble expanded 2x, 3x and 4x, bit 0 first
+    static const uint16_t expand[3][16] =
+    {
+        { 0x0000, 0x0003, 0x000c, 0x000f, 0x0030, 0x0033, 0x003c, 0x003f, 0x00c0, 0x00c3, 0x00cc, 0x00cf, 0x00f0, 0x00f3, 0x00fc, 0x00ff },
+        { 0x0000, 0x0007, 0x0038, 0x003f, 0x01c0, 0x01c7, 0x01f8, 0x01ff, 0x0e00, 0x0e07, 0x0e38, 0x0e3f, 0x0fc0, 0x0fc7, 0x0ff8, 0x0fff },
+        { 0x0000, 0x000f, 0x00f0, 0x00ff, 0x0f00, 0x0f0f, 0x0ff0, 0x0fff, 0xf000, 0xf00f, 0xf0f0, 0xf0ff, 0xff00, 0xff0f, 0xfff0, 0xffff }
+    };
+
+    if ((scale < 2) or (scale > 4))
+    {
+        return value;
+    }
+    const uint16_t * table = expand[scale - 2];
+    return (uint32_t)table[value & 0x0f] | ((uint32_t)table[value >> 4] << (4 * scale));
+}
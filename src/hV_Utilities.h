@@ -112,12 +112,24 @@ void convertRectangle2Polar(uint16_t centerX, uint16_t centerY, uint16_t rectang
 /// @see The Unicode Consortium. The Unicode Standard, Version 6.2.0,
 /// (Mountain View, CA: The Unicode Consortium, 2012. ISBN 978-1-936213-07-8)
 /// http://www.unicode.org/versions/Unicode6.2.0/
+/// @note Not required by gText(), which accepts UTF-8
 ///
 String utf2iso(String s);
 
+///
+/// @brief Decode next UTF-8 character
+/// @param text UTF-8 text
+/// @param length length of text, in bytes
+/// @param[in,out] index index of first byte, updated to next character
+/// @return Unicode codepoint
+/// @note Invalid or incomplete sequences return the first byte, as ISO-8859-1
+/// @n Strings already converted with utf2iso() are displayed unchanged
+///
+uint32_t decodeUTF8(const char * text, uint16_t length, uint16_t & index);
+
 ///
 /// @brief Format string
-/// @details Based on vsprint
+/// @details Based on vsnprintf, into a shared buffer of 128 bytes
 /// @param format format with standard codes
 /// @param ... list of values
 /// @return string with values formatted
@@ -125,6 +137,17 @@ String utf2iso(String s);
 ///
 String formatString(const char * format, ...);
 
+///
+/// @brief Format string into buffer
+/// @details Based on vsnprintf, no heap allocation
+/// @param[out] buffer buffer provided by the caller
+/// @param size size of the buffer, terminating null included
+/// @param format format with standard codes
+/// @param ... list of values
+/// @return length of the formatted string, truncated to size - 1
+///
+uint16_t formatBuffer(char * buffer, uint16_t size, const char * format, ...);
+
 ///
 /// @brief Remove leading and ending characters
 /// @param text input text
@@ -133,6 +156,16 @@ String formatString(const char * format, ...);
 ///
 String trimString(String text);
 
+///
+/// @brief Find text without leading and ending characters
+/// @param text input text
+/// @param length length of text, in bytes
+/// @param[out] start index of first kept character
+/// @return length of trimmed text, in bytes
+/// @note Removed characters are LF CR TAB SPACE, no copy of text
+///
+uint16_t trimString(const char * text, uint16_t length, uint16_t & start);
+
 /// @}
 
 ///
@@ -175,6 +208,13 @@ void setMinMax(uint16_t value, uint16_t & valueMin, uint16_t & valueMax);
 uint32_t roundUp(uint32_t value, uint16_t modulo);
 
 // Utilities
+///
+/// @brief Swap number, int32_t
+/// @param a first number
+/// @param b second number
+///
+void swap(int32_t & a, int32_t & b);
+
 ///
 /// @brief Swap number, int16_t
 /// @param a first number
@@ -196,6 +236,29 @@ void swap(uint16_t & a, uint16_t & b);
 ///
 void swap(uint8_t & a, uint8_t & b);
 
+///
+/// @brief Reverse bits of byte
+/// @param value byte
+/// @return byte with bit 7 as bit 0, bit 6 as bit 1...
+///
+uint8_t reverseBits(uint8_t value);
+
+///
+/// @brief Transpose 8x8 bits matrix
+/// @param[out] bytes 8 bytes, modified
+/// @note Bit 7 - j of byte i becomes bit 7 - i of byte j
+///
+void transpose8x8(uint8_t * bytes);
+
+///
+/// @brief Expand bits of byte
+/// @param value byte
+/// @param scale 1..4
+/// @return each bit repeated scale times, bit 0 as bits 0..scale-1
+/// @note Tables of 16 nibbles for 2x, 3x and 4x
+///
+uint32_t expandBits(uint8_t value, uint8_t scale);
+
 /// @}
 
 #endif // hV_UTILITIES_RELEASE